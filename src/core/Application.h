@@ -23,6 +23,7 @@ struct AppConfig {
   bool vsync = false;
   int renderDistance = 8;
   float fov = 45.0f;
+  std::string columnCacheDirectory; // Empty = off
 };
 
 class Application {
@@ -1,18 +1,38 @@
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+// psapi.h needs windows.h first
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
 #include "Benchmark.h"
 #include "../world/Chunk.h"
 #include "../world/ChunkColumn.h"
+#include "../world/ColumnCache.h"
 #include "../world/WorldGenerator.h"
+#include "../world/World.h"
 #include "Logger.h"
 #include "Profiler.h"
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
 #include <mutex>  // Added for std::mutex
+#include <random>
 #include <thread> // Added for std::thread
 
 static BenchmarkStatus s_Status;
 
 BenchmarkStatus &GetBenchmarkStatus() { return s_Status; }
 
-void StartBenchmarkAsync(const WorldGenConfig &config, int sideSize) {
+void StartBenchmarkAsync(const WorldGenConfig &config, int sideSize,
+                         const std::string &columnCacheDir) {
   if (s_Status.isRunning)
     return; // Prevent multiple runs
 
@@ -20,7 +40,7 @@ void StartBenchmarkAsync(const WorldGenConfig &config, int sideSize) {
   s_Status.isFinished = false;
   s_Status.progress = 0.0f;
 
-  std::thread([config, sideSize]() {
+  std::thread([config, sideSize, columnCacheDir]() {
     // Run logic similar to RunWorldGenBenchmark but updating progress
     BenchmarkResult result = {0};
 
@@ -29,6 +49,8 @@ void StartBenchmarkAsync(const WorldGenConfig &config, int sideSize) {
 
     WorldGenerator generator(config);
     generator.EnableProfiling(true);
+    if (!columnCacheDir.empty())
+      generator.SetColumnCache(ColumnCache::Open(columnCacheDir, config));
     if (config.fixedWorld) {
       generator.GenerateFixedMaps();
     }
@@ -150,3 +172,555 @@ BenchmarkResult RunWorldGenBenchmark(const WorldGenConfig &config,
 
   return result;
 }
+
+// FNV-1a over a chunk's position and block contents
+static uint64_t HashChunk(const Chunk &chunk) {
+  uint64_t h = 0xcbf29ce484222325ULL;
+  auto mix = [&h](uint32_t v) {
+    for (int i = 0; i < 4; ++i) {
+      h ^= (v >> (i * 8)) & 0xff;
+      h *= 0x100000001b3ULL;
+    }
+  };
+  mix((uint32_t)chunk.chunkPosition.x);
+  mix((uint32_t)chunk.chunkPosition.y);
+  mix((uint32_t)chunk.chunkPosition.z);
+  for (int x = 0; x < CHUNK_SIZE; ++x)
+    for (int y = 0; y < CHUNK_SIZE; ++y)
+      for (int z = 0; z < CHUNK_SIZE; ++z) {
+        ChunkBlock b = chunk.getBlock(x, y, z);
+        mix((uint32_t)b.getType() | ((uint32_t)b.metadata << 8));
+      }
+  return h;
+}
+
+static uint64_t GetPeakRSSBytes() {
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS counters;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    return (uint64_t)counters.PeakWorkingSetSize;
+  return 0;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+#ifdef __APPLE__
+  return (uint64_t)usage.ru_maxrss; // Bytes
+#else
+  return (uint64_t)usage.ru_maxrss * 1024; // Kilobytes
+#endif
+#endif
+}
+
+// Nearest-rank percentile of sorted samples
+static float Percentile(const std::vector<float> &sorted, float p) {
+  if (sorted.empty())
+    return 0.0f;
+  size_t rank = (size_t)std::ceil(p / 100.0f * (float)sorted.size());
+  return sorted[std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1];
+}
+
+json RunHeadlessWorldGenBenchmark(const WorldGenConfig &config, int sideSize,
+                                  int threadCount,
+                                  const std::string &columnCacheDir) {
+  if (threadCount <= 0)
+    threadCount = (int)std::max(1u, std::thread::hardware_concurrency());
+  sideSize = std::max(1, sideSize);
+
+  // Every sample is needed for the percentiles
+  Profiler::Get().ClearResults();
+  Profiler::Get().SetHistoryLimit(0);
+
+  auto fixedStart = std::chrono::high_resolution_clock::now();
+  auto fixedMaps = WorldGenerator::BuildFixedMaps(config, threadCount);
+  std::chrono::duration<double, std::milli> fixedDuration =
+      std::chrono::high_resolution_clock::now() - fixedStart;
+
+  std::shared_ptr<ColumnCache> columnCache;
+  if (!columnCacheDir.empty())
+    columnCache = ColumnCache::Open(columnCacheDir, config);
+  size_t cachedColumns = columnCache ? columnCache->GetColumnCount() : 0;
+
+  // Columns are generated a region at a time, like the world does
+  const int R = WorldGenerator::COLUMN_REGION;
+  int regionsPerSide = (sideSize + R - 1) / R;
+  int regionCount = regionsPerSide * regionsPerSide;
+  int origin = -sideSize / 2;
+  int chunksY = config.worldHeight / CHUNK_SIZE;
+
+  std::atomic<int> nextRegion{0};
+  std::atomic<int> chunkCount{0};
+  // Chunk hashes are summed, so the total does not depend on which thread
+  // built which chunk
+  std::atomic<uint64_t> contentHash{0};
+
+  auto worker = [&]() {
+    WorldGenerator generator(config);
+    generator.EnableProfiling(true);
+    generator.SetFixedMaps(fixedMaps);
+    generator.SetColumnCache(columnCache);
+    ChunkColumn *regionColumns[R * R];
+
+    int r;
+    while ((r = nextRegion.fetch_add(1)) < regionCount) {
+      int rx = (r % regionsPerSide) * R;
+      int rz = (r / regionsPerSide) * R;
+      // Fresh columns per region: planned structures are cached in them
+      std::unique_ptr<ChunkColumn[]> columns(new ChunkColumn[R * R]);
+      for (int i = 0; i < R * R; ++i) {
+        bool inside = rx + i % R < sideSize && rz + i / R < sideSize;
+        regionColumns[i] = inside ? &columns[i] : nullptr;
+      }
+      generator.GenerateColumns(regionColumns, origin + rx, origin + rz, R);
+
+      uint64_t hash = 0;
+      for (int i = 0; i < R * R; ++i) {
+        if (!regionColumns[i])
+          continue;
+        int cx = origin + rx + i % R;
+        int cz = origin + rz + i / R;
+        for (int cy = 0; cy < chunksY; ++cy) {
+          auto chunk = std::make_unique<Chunk>();
+          chunk->chunkPosition = glm::ivec3(cx, cy, cz);
+          chunk->setWorld(nullptr);
+          generator.GenerateChunk(*chunk, *regionColumns[i]);
+          hash += HashChunk(*chunk);
+        }
+        chunkCount += chunksY;
+      }
+      contentHash += hash;
+    }
+  };
+
+  auto start = std::chrono::high_resolution_clock::now();
+  std::vector<std::thread> threads;
+  for (int i = 1; i < threadCount; ++i)
+    threads.emplace_back(worker);
+  worker();
+  for (auto &t : threads)
+    t.join();
+  std::chrono::duration<double, std::milli> duration =
+      std::chrono::high_resolution_clock::now() - start;
+
+  double seconds = duration.count() / 1000.0;
+  int columnCount = sideSize * sideSize;
+  char hashText[17];
+  snprintf(hashText, sizeof(hashText), "%016llx",
+           (unsigned long long)contentHash.load());
+
+  json report;
+  report["seed"] = config.seed;
+  report["area"] = sideSize;
+  report["threads"] = threadCount;
+  report["columns"] = columnCount;
+  report["chunks"] = chunkCount.load();
+  report["fixedMapsMs"] = fixedDuration.count();
+  // Columns already cached before the run (0 without a cache)
+  report["columnCache"] = columnCache ? json(columnCacheDir) : json();
+  report["cachedColumns"] = cachedColumns;
+  report["totalMs"] = duration.count();
+  report["columnsPerSecond"] = seconds > 0.0 ? columnCount / seconds : 0.0;
+  report["chunksPerSecond"] =
+      seconds > 0.0 ? chunkCount.load() / seconds : 0.0;
+
+  // Per-scope timings in milliseconds (GenChunk_*, GenColumn, decorators)
+  json stages = json::object();
+  for (auto &kv : Profiler::Get().GetResults()) {
+    std::vector<float> samples = kv.second;
+    if (samples.empty())
+      continue;
+    std::sort(samples.begin(), samples.end());
+    double sum = 0.0;
+    for (float v : samples)
+      sum += v;
+
+    json stage;
+    stage["count"] = samples.size();
+    stage["mean"] = sum / samples.size();
+    stage["p50"] = Percentile(samples, 50.0f);
+    stage["p90"] = Percentile(samples, 90.0f);
+    stage["p99"] = Percentile(samples, 99.0f);
+    stage["max"] = samples.back();
+    stages[kv.first] = stage;
+  }
+  report["stages"] = stages;
+  report["peakRssBytes"] = GetPeakRSSBytes();
+  report["contentHash"] = hashText;
+
+  Profiler::Get().SetHistoryLimit(100);
+  Profiler::Get().ClearResults();
+  return report;
+}
+
+json RunPipelineScalingBenchmark(const WorldGenConfig &config, int radius,
+                                 int maxThreads) {
+  if (maxThreads <= 0)
+    maxThreads = (int)std::max(1u, std::thread::hardware_concurrency());
+  radius = std::max(1, radius);
+
+  std::vector<int> threadCounts;
+  for (int t = 1; t < maxThreads; t *= 2)
+    threadCounts.push_back(t);
+  threadCounts.push_back(maxThreads);
+
+  // Same column set as World::loadChunks around the origin
+  size_t targetChunks = 0;
+  int chunksY = config.worldHeight / CHUNK_SIZE;
+  for (int x = -radius; x <= radius; ++x)
+    for (int z = -radius; z <= radius; ++z)
+      if (x * x + z * z <= radius * radius)
+        targetChunks += chunksY;
+
+  json report;
+  report["seed"] = config.seed;
+  report["radius"] = radius;
+  report["chunks"] = targetChunks;
+  json runs = json::array();
+
+  // Stage capacities and total time of the first run, for the speedups
+  double baseGen = 0.0, baseLight = 0.0, baseMesh = 0.0, baseTotal = 0.0;
+
+  for (int threads : threadCounts) {
+    WorldOptions options;
+    options.genThreads = threads;
+    options.meshThreads = threads;
+    options.headless = true;
+
+    // Worlds are built and torn down outside the timed section
+    auto world = std::make_unique<World>(config, options);
+    const glm::vec3 spawn(0.0f);
+    const glm::mat4 viewProjection(1.0f);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    // Drive the world like the game loop does, one request pass per tick
+    while (world->getChunkCount() < targetChunks || !world->isPipelineIdle()) {
+      world->loadChunks(spawn, radius, viewProjection);
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::chrono::duration<double, std::milli> duration =
+        std::chrono::high_resolution_clock::now() - start;
+    WorldPipelineStats stats = world->getPipelineStats();
+    world.reset();
+
+    double seconds = duration.count() / 1000.0;
+    // A stage's capacity is what its threads could sustain if never starved:
+    // the per-thread rate while busy times the threads that can work at
+    // once. Its speedup over the first run shows where scaling stops.
+    auto stage = [&](uint64_t items, double busyMs, int parallel,
+                     double &base) {
+      json j;
+      double busySeconds = busyMs / 1000.0;
+      double capacity =
+          busySeconds > 0.0 ? items / busySeconds * parallel : 0.0;
+      if (base == 0.0)
+        base = capacity;
+      j["items"] = items;
+      j["busyMs"] = busyMs;
+      j["capacityPerSecond"] = capacity;
+      j["speedup"] = base > 0.0 ? capacity / base : 0.0;
+      // Fraction of the stage's thread time spent working
+      j["utilisation"] =
+          seconds > 0.0 ? busySeconds / (seconds * parallel) : 0.0;
+      return j;
+    };
+    auto lock = [](const WorldPipelineStats::Lock &l) {
+      json j;
+      j["contended"] = l.contended;
+      j["waitMs"] = l.waitMs;
+      return j;
+    };
+
+    json run;
+    run["threads"] = threads;
+    run["totalMs"] = duration.count();
+    run["chunksPerSecond"] = seconds > 0.0 ? targetChunks / seconds : 0.0;
+    if (baseTotal == 0.0)
+      baseTotal = duration.count();
+    run["speedup"] =
+        duration.count() > 0.0 ? baseTotal / duration.count() : 0.0;
+    // Lighting runs under the world's light mutex, one chunk at a time
+    run["stages"]["generate"] =
+        stage(stats.chunksGenerated, stats.genMs, threads, baseGen);
+    run["stages"]["light"] =
+        stage(stats.chunksGenerated, stats.lightMs, 1, baseLight);
+    run["stages"]["mesh"] =
+        stage(stats.meshesBuilt, stats.meshMs, threads, baseMesh);
+    run["locks"]["world"] = lock(stats.worldLock);
+    run["locks"]["light"] = lock(stats.lightLock);
+    run["locks"]["column"] = lock(stats.columnLock);
+    run["locks"]["genQueue"] = lock(stats.genQueueLock);
+    run["locks"]["meshQueue"] = lock(stats.meshQueueLock);
+    runs.push_back(run);
+
+    LOG_INFO("Pipeline benchmark: {} threads, {:.1f} ms", threads,
+             duration.count());
+  }
+
+  report["runs"] = runs;
+  return report;
+}
+
+// Keeps the results of benchmarked reads alive
+static volatile uint64_t s_Sink;
+
+// Calls 'body' once to warm up, then repeatedly for at least minMs, and
+// reports the mean cost per call and per voxel
+template <typename F>
+static json TimeKernel(F &&body, double voxelsPerCall, double minMs = 200.0) {
+  using Clock = std::chrono::high_resolution_clock;
+  body();
+
+  int iterations = 0;
+  double elapsedNs = 0.0;
+  auto start = Clock::now();
+  do {
+    body();
+    ++iterations;
+    elapsedNs = std::chrono::duration<double, std::nano>(Clock::now() - start)
+                    .count();
+  } while (elapsedNs < minMs * 1e6);
+
+  double nsPerCall = elapsedNs / iterations;
+  json j;
+  j["iterations"] = iterations;
+  j["voxelsPerCall"] = voxelsPerCall;
+  j["nsPerCall"] = nsPerCall;
+  j["nsPerVoxel"] = voxelsPerCall > 0.0 ? nsPerCall / voxelsPerCall : 0.0;
+  return j;
+}
+
+// Columns within this many chunks of a fixture's centre are loaded
+static const int FIXTURE_RADIUS = 2;
+
+// Generates, lights and meshes the area around chunk column 'centre' in a
+// headless world, through the same pipeline as the game
+static std::unique_ptr<World> BuildFixtureWorld(const WorldGenConfig &config,
+                                                glm::ivec2 centre) {
+  // Nothing may remesh the fixture while a kernel is timed; lightColumn
+  // would otherwise queue the column on every iteration
+  WorldOptions options;
+  options.headless = true;
+  options.meshing = false;
+  auto world = std::make_unique<World>(config, options);
+
+  size_t targetChunks = 0;
+  int chunksY = config.worldHeight / CHUNK_SIZE;
+  for (int x = -FIXTURE_RADIUS; x <= FIXTURE_RADIUS; ++x)
+    for (int z = -FIXTURE_RADIUS; z <= FIXTURE_RADIUS; ++z)
+      if (x * x + z * z <= FIXTURE_RADIUS * FIXTURE_RADIUS)
+        targetChunks += chunksY;
+
+  glm::vec3 spawn((centre.x + 0.5f) * CHUNK_SIZE, 0.0f,
+                  (centre.y + 0.5f) * CHUNK_SIZE);
+  while (world->getChunkCount() < targetChunks || !world->isPipelineIdle()) {
+    world->loadChunks(spawn, FIXTURE_RADIUS, glm::mat4(1.0f));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return world;
+}
+
+static json RunFixtureKernels(const WorldGenConfig &config,
+                              const std::string &name) {
+  const int VOLUME = CHUNK_SIZE * CHUNK_SIZE * CHUNK_SIZE;
+  int chunksY = config.worldHeight / CHUNK_SIZE;
+  std::mt19937 rng(config.seed);
+
+  // Fixture column: the origin, or the first forest found along +X
+  glm::ivec2 centre(0, 0);
+  WorldGenerator generator(config);
+  if (name == "forest") {
+    for (int i = 0; i < 256; ++i) {
+      if (generator.GetBiome(i * 64, 0) == BIOME_FOREST) {
+        centre.x = i * 2;
+        break;
+      }
+    }
+  }
+
+  auto world = BuildFixtureWorld(config, centre);
+  int gx0 = centre.x * CHUNK_SIZE;
+  int gz0 = centre.y * CHUNK_SIZE;
+  int surface = world->getHeight(gx0 + CHUNK_SIZE / 2, gz0 + CHUNK_SIZE / 2);
+  int cy = name == "cave" ? 1 : surface / CHUNK_SIZE;
+  cy = std::max(0, std::min(chunksY - 1, cy));
+  Chunk *chunk = world->getChunk(centre.x, cy, centre.y);
+
+  json fixture;
+  fixture["chunk"] = {centre.x, cy, centre.y};
+  fixture["surfaceHeight"] = surface;
+  json &kernels = fixture["kernels"];
+
+  // Meshing
+  int opaqueCount = 0;
+  std::vector<float> mesh = chunk->generateGeometry(opaqueCount);
+  kernels["generateGeometry"] = TimeKernel(
+      [&] {
+        int opaque = 0;
+        s_Sink = chunk->generateGeometry(opaque).size();
+      },
+      VOLUME);
+
+  // Column lighting: unlinking and relinking every chunk of the column
+  // makes the last link sweep and spread it again
+  {
+    std::vector<Chunk *> column;
+    for (int y = 0; y < chunksY; ++y)
+      column.push_back(world->getChunk(centre.x, y, centre.y));
+    LightEngine engine(*world);
+    kernels["lightColumn"] = TimeKernel(
+        [&] {
+          std::lock_guard<std::mutex> lock(engine.getMutex());
+          for (Chunk *c : column)
+            engine.onChunkUnlinked(c);
+          for (Chunk *c : column)
+            engine.onChunkLinked(c);
+        },
+        (double)VOLUME * chunksY);
+  }
+
+  // Transparent sort, from a camera circling above the chunk
+  {
+    size_t opaqueFloats = (size_t)opaqueCount * 14;
+    std::vector<float> transparent(mesh.begin() + opaqueFloats, mesh.end());
+    glm::vec3 origin(chunk->chunkPosition * CHUNK_SIZE);
+    std::vector<float> sorted;
+    int step = 0;
+    kernels["transparentSort"] = TimeKernel(
+        [&] {
+          float a = (float)(step++ % 64) * 0.1f;
+          glm::vec3 camera = origin + glm::vec3(16.0f + 24.0f * std::cos(a),
+                                                40.0f,
+                                                16.0f + 24.0f * std::sin(a));
+          Chunk::sortTransparentFaces(transparent, origin, camera, sorted);
+          s_Sink = sorted.size();
+        },
+        VOLUME);
+    kernels["transparentSort"]["faces"] = transparent.size() / (14 * 6);
+  }
+
+  // Raycasts from random points of the fixture chunk; voxels are the
+  // distance each ray travels
+  {
+    const int RAYS = 256;
+    const float MAX_DIST = 32.0f;
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> inChunk(0.0f, (float)CHUNK_SIZE);
+    std::vector<glm::vec3> origins(RAYS), dirs(RAYS);
+    double travelled = 0.0;
+    glm::vec3 base(chunk->chunkPosition * CHUNK_SIZE);
+    for (int i = 0; i < RAYS; ++i) {
+      origins[i] = base + glm::vec3(inChunk(rng), inChunk(rng), inChunk(rng));
+      glm::vec3 d(unit(rng), unit(rng), unit(rng));
+      dirs[i] = glm::length(d) > 0.01f ? glm::normalize(d)
+                                       : glm::vec3(0.0f, -1.0f, 0.0f);
+      glm::ivec3 hit, pre;
+      if (world->raycast(origins[i], dirs[i], MAX_DIST, hit, pre))
+        travelled += glm::distance(origins[i], glm::vec3(hit) + 0.5f);
+      else
+        travelled += MAX_DIST;
+    }
+    kernels["raycast"] = TimeKernel(
+        [&] {
+          glm::ivec3 hit, pre;
+          uint64_t hits = 0;
+          for (int i = 0; i < RAYS; ++i)
+            hits += world->raycast(origins[i], dirs[i], MAX_DIST, hit, pre);
+          s_Sink = hits;
+        },
+        std::max(1.0, travelled));
+  }
+
+  // Random access across the loaded area
+  {
+    const int READS = 1 << 16;
+    int span = (FIXTURE_RADIUS * 2 - 1) * CHUNK_SIZE;
+    std::uniform_int_distribution<int> horizontal(-span / 2, span / 2);
+    std::uniform_int_distribution<int> vertical(0, config.worldHeight - 1);
+    std::vector<glm::ivec3> points(READS);
+    for (glm::ivec3 &p : points)
+      p = glm::ivec3(gx0 + CHUNK_SIZE / 2 + horizontal(rng), vertical(rng),
+                     gz0 + CHUNK_SIZE / 2 + horizontal(rng));
+    kernels["getBlock"] = TimeKernel(
+        [&] {
+          uint64_t sum = 0;
+          for (const glm::ivec3 &p : points)
+            sum += world->getBlock(p.x, p.y, p.z).getType();
+          s_Sink = sum;
+        },
+        READS);
+  }
+
+  // Single-point cave test over the fixture chunk
+  {
+    CaveGenerator caves(config);
+    caves.generator = &generator;
+    int heights[CHUNK_SIZE][CHUNK_SIZE];
+    for (int x = 0; x < CHUNK_SIZE; ++x)
+      for (int z = 0; z < CHUNK_SIZE; ++z)
+        heights[x][z] = world->getHeight(gx0 + x, gz0 + z);
+    int gy0 = cy * CHUNK_SIZE;
+    kernels["isCaveAt"] = TimeKernel(
+        [&] {
+          uint64_t carved = 0;
+          for (int x = 0; x < CHUNK_SIZE; ++x)
+            for (int y = 0; y < CHUNK_SIZE; ++y)
+              for (int z = 0; z < CHUNK_SIZE; ++z)
+                carved += caves.IsCaveAt(gx0 + x, gy0 + y, gz0 + z,
+                                         heights[x][z]);
+          s_Sink = carved;
+        },
+        VOLUME);
+  }
+
+  // Column generation; voxels are the column's surface cells
+  {
+    ChunkColumn column;
+    int next = 0;
+    kernels["generateColumn"] = TimeKernel(
+        [&] {
+          generator.GenerateColumn(column, centre.x + (next++ % 16),
+                                   centre.y);
+          s_Sink = column.heightMap[0][0];
+        },
+        CHUNK_SIZE * CHUNK_SIZE);
+  }
+
+  return fixture;
+}
+
+json RunKernelBenchmarks(const WorldGenConfig &config) {
+  const char *names[] = {"flat", "mountain", "cave", "forest"};
+
+  json report;
+  report["seed"] = config.seed;
+  for (const char *name : names) {
+    WorldGenConfig fixture = config;
+    std::string n = name;
+    if (n == "flat") {
+      for (auto &kv : fixture.landformOverrides) {
+        kv.second.baseHeight = 64.0f;
+        kv.second.heightVariation = 0.0f;
+      }
+      fixture.enableCaves = false;
+      fixture.enableRavines = false;
+      fixture.enableRivers = false;
+      fixture.enableTrees = false;
+    } else if (n == "mountain") {
+      LandformConfigOverride mountains = fixture.landformOverrides["mountains"];
+      for (auto &kv : fixture.landformOverrides)
+        kv.second = mountains;
+      fixture.enableRivers = false;
+    } else if (n == "cave") {
+      fixture.enableCaves = true;
+      fixture.enableRavines = true;
+    } else if (n == "forest") {
+      fixture.enableTrees = true;
+      fixture.enableFlora = true;
+      fixture.oakDensity = std::max(fixture.oakDensity, 20.0f);
+    }
+
+    LOG_INFO("Kernel benchmarks: {} fixture", n);
+    report["fixtures"][n] = RunFixtureKernels(fixture, n);
+  }
+  return report;
+}
@@ -33,8 +33,35 @@ struct BenchmarkStatus {
 BenchmarkResult RunWorldGenBenchmark(const WorldGenConfig &config,
                                      int sideSize);
 
-// Starts benchmark in a detached thread
-void StartBenchmarkAsync(const WorldGenConfig &config, int sideSize);
+// Starts benchmark in a detached thread. With a columnCacheDir, columns
+// come from (and go to) the persistent column cache.
+void StartBenchmarkAsync(const WorldGenConfig &config, int sideSize,
+                         const std::string &columnCacheDir = std::string());
 BenchmarkStatus &GetBenchmarkStatus();
 
+// Headless world generation run (no window or GL context), for tracking
+// regressions in CI. Generates sideSize x sideSize columns centred on the
+// origin on 'threadCount' threads (0 = hardware concurrency) and returns a
+// JSON report: throughput, per-stage timing percentiles, peak RSS and a hash
+// of the generated blocks that is independent of the thread count.
+// With a columnCacheDir, columns come from (and go to) the persistent
+// column cache, so a repeated run measures the chunk stage alone.
+json RunHeadlessWorldGenBenchmark(
+    const WorldGenConfig &config, int sideSize, int threadCount,
+    const std::string &columnCacheDir = std::string());
+
+// Headless scaling run of the full World pipeline (generation workers,
+// lighting and meshing) over the columns within 'radius' chunks of the
+// origin, once per thread count 1, 2, 4 ... maxThreads (0 = hardware
+// concurrency). Each run reports time-to-complete, per-stage throughput and
+// lock contention, plus each stage's speedup over the single-thread run.
+json RunPipelineScalingBenchmark(const WorldGenConfig &config, int radius,
+                                 int maxThreads);
+
+// Headless micro-benchmarks of the hot kernels (meshing, column lighting,
+// transparent sort, raycast, getBlock, cave sampling, column generation) on
+// flat, mountain, cave and forest fixtures generated from config's seed.
+// Every kernel reports ns/voxel.
+json RunKernelBenchmarks(const WorldGenConfig &config);
+
 #endif // BENCHMARK_H
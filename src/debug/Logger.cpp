@@ -10,14 +10,18 @@ std::shared_ptr<spdlog::logger> Logger::s_ResourceLogger;
 std::shared_ptr<spdlog::logger> Logger::s_WorldLogger;
 std::shared_ptr<spdlog::logger> Logger::s_PhysicsLogger;
 
-void Logger::Init() {
+void Logger::Init(bool consoleToStderr) {
   if (!std::filesystem::exists("logs")) {
     std::filesystem::create_directory("logs");
   }
 
   std::vector<spdlog::sink_ptr> logSinks;
-  logSinks.emplace_back(
-      std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
+  if (consoleToStderr)
+    logSinks.emplace_back(
+        std::make_shared<spdlog::sinks::stderr_color_sink_mt>());
+  else
+    logSinks.emplace_back(
+        std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
   logSinks.emplace_back(std::make_shared<spdlog::sinks::basic_file_sink_mt>(
       "logs/Lithos.log", true));
 
@@ -11,7 +11,9 @@
 
 class Logger {
 public:
-  static void Init();
+  // Console output goes to stderr instead of stdout if 'consoleToStderr'
+  // (headless benchmarks keep stdout for their JSON report)
+  static void Init(bool consoleToStderr = false);
 
   inline static std::shared_ptr<spdlog::logger> &GetMainLogger() {
     return s_MainLogger;
@@ -19,7 +19,7 @@ void Profiler::WriteProfile(const ProfileResult &result) {
 
   auto &history = m_Results[result.Name];
   history.push_back(duration);
-  if (history.size() > 100) {
+  if (m_HistoryLimit > 0 && history.size() > m_HistoryLimit) {
     history.erase(history.begin());
   }
 }
@@ -38,6 +38,8 @@ public:
     return m_Results;
   }
   void ClearResults() { m_Results.clear(); }
+  // Samples kept per scope (0 = keep all, for benchmark runs)
+  void SetHistoryLimit(size_t limit) { m_HistoryLimit = limit; }
 
 private:
   Profiler();
@@ -47,6 +49,7 @@ private:
   std::mutex m_Lock;
   std::unordered_map<std::string, std::vector<float>>
       m_Results; // Name -> History
+  size_t m_HistoryLimit = 100;
 };
 
 class ProfileTimer {
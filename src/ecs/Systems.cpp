@@ -4,6 +4,7 @@
 #include "../world/World.h"
 #include "Components.h"
 #include <cmath>
+#include <cstddef>
 #include <glm/gtc/matrix_transform.hpp>
 #include <iostream>
 
@@ -93,6 +94,8 @@ void CollisionSystem::Update(entt::registry &registry, World &world, float dt) {
 // --- Render System ---
 unsigned int RenderSystem::cubeVAO = 0;
 unsigned int RenderSystem::cubeVBO = 0;
+unsigned int RenderSystem::instanceVBO = 0;
+std::vector<RenderSystem::CubeInstance> RenderSystem::instances;
 
 // --- Player Control System ---
 
@@ -492,8 +495,26 @@ void RenderSystem::initCubeMesh() {
 
   // Disable others to rely on static values
   glDisableVertexAttribArray(1); // aColor
-  glDisableVertexAttribArray(3); // aLight
-  glDisableVertexAttribArray(4); // aTexOrigin
+
+  // Instance attributes: light, texture origin, position, scale
+  glGenBuffers(1, &instanceVBO);
+  glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+  GLsizei stride = sizeof(CubeInstance);
+  glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, stride,
+                        (void *)offsetof(CubeInstance, light));
+  glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, stride,
+                        (void *)offsetof(CubeInstance, texOrigin));
+  glVertexAttribPointer(5, 3, GL_FLOAT, GL_FALSE, stride,
+                        (void *)offsetof(CubeInstance, position));
+  glVertexAttribPointer(6, 3, GL_FLOAT, GL_FALSE, stride,
+                        (void *)offsetof(CubeInstance, scale));
+  for (int loc = 3; loc <= 6; ++loc) {
+    glEnableVertexAttribArray(loc);
+    glVertexAttribDivisor(loc, 1);
+  }
+
+  glBindVertexArray(0);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
 void RenderSystem::Render(entt::registry &registry, World &world,
@@ -502,43 +523,69 @@ void RenderSystem::Render(entt::registry &registry, World &world,
 
   auto view = registry.view<TransformComponent, BlockComponent>();
 
-  glBindVertexArray(cubeVAO);
+  // Gather every block entity into one instance buffer.
+  // Texture origins are looked up once per block type and lighting once per
+  // chunk, so an avalanche of falling sand costs one registry lookup and a
+  // handful of world locks instead of one of each per entity.
+  instances.clear();
 
-  // Set default attributes needed by shader
-  // aColor (Loc 1) = White
-  glVertexAttrib4f(1, 1.0f, 1.0f, 1.0f, 1.0f);
+  glm::vec2 uvCache[256];
+  bool uvCached[256] = {false};
 
-  // aLight (Loc 3) - We will update this per entity
+  const Chunk *lightChunk = nullptr;
+  glm::ivec3 lightChunkPos(0);
+  bool haveLightChunk = false;
 
-  view.each([&shader, &world](auto entity, auto &transform, auto &blockComp) {
-    glm::mat4 model = glm::mat4(1.0f);
-    model = glm::translate(model, transform.position);
-    model = glm::scale(model, transform.scale);
-
-    shader.setMat4("model", model);
+  view.each([&](auto entity, auto &transform, auto &blockComp) {
+    CubeInstance inst;
+    inst.position = transform.position;
+    inst.scale = transform.scale;
 
     // Setup Texture Origin
-    Block *block = BlockRegistry::getInstance().getBlock(blockComp.type);
-    float u, v;
-    block->getTextureUV(2, u, v);
-    glVertexAttrib2f(4, u, v);
+    uint8_t type = (uint8_t)blockComp.type;
+    if (!uvCached[type]) {
+      Block *block = BlockRegistry::getInstance().getBlock(blockComp.type);
+      block->getTextureUV(2, uvCache[type].x, uvCache[type].y);
+      uvCached[type] = true;
+    }
+    inst.texOrigin = uvCache[type];
+
+    // Sample Light at the center of the entity
+    glm::ivec3 p = glm::ivec3(glm::floor(transform.position));
+    glm::ivec3 cp = glm::ivec3(glm::floor(glm::vec3(p) / (float)CHUNK_SIZE));
+    if (!haveLightChunk || cp != lightChunkPos) {
+      lightChunk = world.getChunk(cp.x, cp.y, cp.z);
+      lightChunkPos = cp;
+      haveLightChunk = true;
+    }
+
+    float sun = 1.0f; // Unloaded chunks read as open sky
+    float blk = 0.0f;
+    if (lightChunk) {
+      glm::ivec3 l = p - cp * CHUNK_SIZE;
+      sun = lightChunk->getSkyLight(l.x, l.y, l.z) / 15.0f;
+      blk = lightChunk->getBlockLight(l.x, l.y, l.z) / 15.0f;
+    }
+    inst.light = glm::vec3(sun, blk, 0.0f); // AO = 0 (full brightness)
 
-    // Sample Light
-    // Sample at the center of the entity
-    int x = std::floor(transform.position.x);
-    int y = std::floor(transform.position.y);
-    int z = std::floor(transform.position.z);
+    instances.push_back(inst);
+  });
 
-    ChunkBlock b = world.getBlock(x, y, z);
-    float sun = b.skyLight / 15.0f;
-    float blk = b.blockLight / 15.0f;
+  if (instances.empty())
+    return;
 
-    // Use aLight uniform logic directly
-    glVertexAttrib3f(3, sun, blk, 0.0f); // AO = 0 (full brightness)
+  glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+  glBufferData(GL_ARRAY_BUFFER, instances.size() * sizeof(CubeInstance),
+               instances.data(), GL_STREAM_DRAW);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-    glDrawArrays(GL_TRIANGLES, 0, 36);
-  });
-  // Cleanup? Restore state?
-  // Not strictly necessary if main loop resets VAOs, but good practice to
-  // enable arrays if needed.
+  // Set default attributes needed by shader
+  // aColor (Loc 1) = White
+  glVertexAttrib4f(1, 1.0f, 1.0f, 1.0f, 1.0f);
+
+  shader.setBool("useInstancing", true);
+  glBindVertexArray(cubeVAO);
+  glDrawArraysInstanced(GL_TRIANGLES, 0, 36, (GLsizei)instances.size());
+  glBindVertexArray(0);
+  shader.setBool("useInstancing", false);
 }
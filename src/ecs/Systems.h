@@ -4,6 +4,7 @@
 #include "../render/Shader.h"
 #include <entt/entt.hpp>
 #include <glm/glm.hpp>
+#include <vector>
 
 class World; // Forward declaration
 class Camera;
@@ -24,8 +25,17 @@ public:
                      const glm::mat4 &viewProjection);
 
 private:
+  // Per-instance data for the block entity cube (locations 3-6)
+  struct CubeInstance {
+    glm::vec3 light; // Sky, Block, AO
+    glm::vec2 texOrigin;
+    glm::vec3 position;
+    glm::vec3 scale;
+  };
+
   static void initCubeMesh();
-  static unsigned int cubeVAO, cubeVBO;
+  static unsigned int cubeVAO, cubeVBO, instanceVBO;
+  static std::vector<CubeInstance> instances; // Reused between frames
 };
 
 class Camera; // Forward declaration
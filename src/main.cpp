@@ -1,13 +1,73 @@
 #include <argparse/argparse.hpp>
+#include <fstream>
 #include <iostream>
 #include <random>
 
 
 #include "core/Application.h"
+#include "debug/Benchmark.h"
 #include "debug/CrashHandler.h"
 #include "debug/Logger.h"
 
 
+// Headless --bench-worldgen / --bench-pipeline / --bench-kernels modes. The
+// seed defaults to the preset's so runs are reproducible.
+static int RunBenchmarkCLI(argparse::ArgumentParser &program) {
+  WorldGenConfig genConfig;
+  if (auto path = program.present("--bench-config")) {
+    std::ifstream file(*path);
+    if (!file.is_open()) {
+      LOG_ERROR("Failed to load configuration from {}", *path);
+      return 1;
+    }
+    try {
+      json j;
+      file >> j;
+      genConfig = j.get<WorldGenConfig>();
+    } catch (const std::exception &e) {
+      LOG_ERROR("JSON Load Error: {}", e.what());
+      return 1;
+    }
+  }
+  if (program.present<int>("--seed"))
+    genConfig.seed = program.get<int>("--seed");
+
+  json report;
+  if (program.get<bool>("--bench-kernels")) {
+    LOG_INFO("Kernel benchmarks: seed {}", genConfig.seed);
+    report = RunKernelBenchmarks(genConfig);
+  } else if (program.get<bool>("--bench-pipeline")) {
+    LOG_INFO("Pipeline scaling benchmark: seed {}, radius {}", genConfig.seed,
+             program.get<int>("--bench-radius"));
+    report = RunPipelineScalingBenchmark(genConfig,
+                                         program.get<int>("--bench-radius"),
+                                         program.get<int>("--bench-threads"));
+  } else {
+    LOG_INFO("World generation benchmark: seed {}, {}x{} columns",
+             genConfig.seed, program.get<int>("--bench-area"),
+             program.get<int>("--bench-area"));
+    std::string columnCache;
+    if (auto dir = program.present("--column-cache"))
+      columnCache = *dir;
+    report = RunHeadlessWorldGenBenchmark(
+        genConfig, program.get<int>("--bench-area"),
+        program.get<int>("--bench-threads"), columnCache);
+  }
+
+  if (auto path = program.present("--bench-output")) {
+    std::ofstream file(*path);
+    if (!file.is_open()) {
+      LOG_ERROR("Failed to write benchmark report to {}", *path);
+      return 1;
+    }
+    file << report.dump(2) << std::endl;
+    LOG_INFO("Benchmark report written to {}", *path);
+  } else {
+    std::cout << report.dump(2) << std::endl;
+  }
+  return 0;
+}
+
 int main(int argc, char *argv[]) {
   // Argument Parsing
   argparse::ArgumentParser program("Lithos");
@@ -39,6 +99,47 @@ int main(int argc, char *argv[]) {
 
   program.add_argument("--seed").help("World generation seed").scan<'i', int>();
 
+  // Headless world generation benchmark
+  program.add_argument("--bench-worldgen")
+      .help("Run the world generation benchmark without a window and exit")
+      .default_value(false)
+      .implicit_value(true);
+
+  program.add_argument("--bench-pipeline")
+      .help("Run the threaded chunk pipeline scaling benchmark and exit")
+      .default_value(false)
+      .implicit_value(true);
+
+  program.add_argument("--bench-kernels")
+      .help("Run the hot kernel micro-benchmarks and exit")
+      .default_value(false)
+      .implicit_value(true);
+
+  program.add_argument("--bench-radius")
+      .help("Pipeline benchmark spawn radius, in chunks")
+      .default_value(8)
+      .scan<'i', int>();
+
+  program.add_argument("--bench-area")
+      .help("Benchmark area, in columns per side")
+      .default_value(16)
+      .scan<'i', int>();
+
+  program.add_argument("--bench-threads")
+      .help("Benchmark threads, the maximum for --bench-pipeline "
+            "(0 = hardware concurrency)")
+      .default_value(0)
+      .scan<'i', int>();
+
+  program.add_argument("--bench-config")
+      .help("World generation preset (JSON) for the benchmark");
+
+  program.add_argument("--bench-output")
+      .help("Write the benchmark report to this file instead of stdout");
+
+  program.add_argument("--column-cache")
+      .help("Column cache directory (off by default)");
+
   try {
     program.parse_args(argc, argv);
   } catch (const std::runtime_error &err) {
@@ -47,10 +148,17 @@ int main(int argc, char *argv[]) {
     return 1;
   }
 
+  bool benchmark = program.get<bool>("--bench-worldgen") ||
+                   program.get<bool>("--bench-pipeline") ||
+                   program.get<bool>("--bench-kernels");
+
   // Init Core Systems
-  Logger::Init();
+  Logger::Init(benchmark);
   CrashHandler::Init();
 
+  if (benchmark)
+    return RunBenchmarkCLI(program);
+
   // Config
   AppConfig config;
   config.width = program.get<int>("--width");
@@ -58,6 +166,8 @@ int main(int argc, char *argv[]) {
   config.vsync = program.get<bool>("--vsync");
   config.renderDistance = program.get<int>("--render-distance");
   config.fov = program.get<float>("--fov");
+  if (auto dir = program.present("--column-cache"))
+    config.columnCacheDirectory = *dir;
 
   // Seed Handling
   if (program.present<int>("--seed")) {
@@ -0,0 +1,223 @@
+#include "ChunkMeshArena.h"
+#include "../debug/Logger.h"
+#include <algorithm>
+#include <iterator>
+
+ChunkMeshArena::ChunkMeshArena() {
+  // GL objects are created lazily on the main thread
+}
+
+ChunkMeshArena::~ChunkMeshArena() {
+  for (Page &page : m_Pages) {
+    glDeleteVertexArrays(1, &page.VAO);
+    glDeleteBuffers(1, &page.VBO);
+  }
+  if (m_GLReady) {
+    glDeleteBuffers(1, &m_OriginBuffer);
+    glDeleteBuffers(1, &m_IndirectBuffer);
+  }
+}
+
+void ChunkMeshArena::InitGL() {
+  if (m_GLReady)
+    return;
+  m_GLReady = true;
+
+  m_UseIndirect = GLEW_ARB_multi_draw_indirect && GLEW_ARB_base_instance;
+  glGenBuffers(1, &m_OriginBuffer);
+  glGenBuffers(1, &m_IndirectBuffer);
+
+  LOG_RENDER_INFO("Chunk mesh arena: {} submission",
+                  m_UseIndirect ? "multi-draw indirect" : "per-draw");
+}
+
+int ChunkMeshArena::CreatePage(int capacity) {
+  Page page;
+  page.capacity = capacity;
+  page.freeBlocks[0] = capacity;
+
+  glGenVertexArrays(1, &page.VAO);
+  glGenBuffers(1, &page.VBO);
+  glBindVertexArray(page.VAO);
+  glBindBuffer(GL_ARRAY_BUFFER, page.VBO);
+  glBufferData(GL_ARRAY_BUFFER,
+               (size_t)capacity * FLOATS_PER_VERTEX * sizeof(float), nullptr,
+               GL_DYNAMIC_DRAW);
+
+  // Same layout as the chunk mesher output
+  GLsizei stride = FLOATS_PER_VERTEX * sizeof(float);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void *)0); // Pos
+  glEnableVertexAttribArray(0);
+  glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, stride,
+                        (void *)(3 * sizeof(float))); // Color (Vec4)
+  glEnableVertexAttribArray(1);
+  glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride,
+                        (void *)(7 * sizeof(float))); // UV
+  glEnableVertexAttribArray(2);
+  glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, stride,
+                        (void *)(9 * sizeof(float))); // Light(Sky,Block,AO)
+  glEnableVertexAttribArray(3);
+  glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, stride,
+                        (void *)(12 * sizeof(float))); // TexOrigin
+  glEnableVertexAttribArray(4);
+
+  if (m_UseIndirect) {
+    // Chunk origin, one per draw (selected by baseInstance)
+    glBindBuffer(GL_ARRAY_BUFFER, m_OriginBuffer);
+    glVertexAttribPointer(5, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3),
+                          (void *)0);
+    glVertexAttribDivisor(5, 1);
+    glEnableVertexAttribArray(5);
+  }
+
+  glBindVertexArray(0);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  m_Pages.push_back(std::move(page));
+  return (int)m_Pages.size() - 1;
+}
+
+ArenaAllocation ChunkMeshArena::Allocate(int count) {
+  ArenaAllocation alloc;
+  if (count <= 0)
+    return alloc;
+
+  InitGL();
+  std::lock_guard<std::mutex> lock(m_Mutex);
+
+  // First fit across existing pages
+  for (int p = 0; p < (int)m_Pages.size() && !alloc.valid(); ++p) {
+    auto &blocks = m_Pages[p].freeBlocks;
+    for (auto it = blocks.begin(); it != blocks.end(); ++it) {
+      if (it->second < count)
+        continue;
+      alloc.page = p;
+      alloc.first = it->first;
+      alloc.count = count;
+      int remaining = it->second - count;
+      int next = it->first + count;
+      blocks.erase(it);
+      if (remaining > 0)
+        blocks[next] = remaining;
+      break;
+    }
+  }
+
+  if (!alloc.valid()) {
+    // Oversized meshes get a page of their own
+    int p = CreatePage(std::max(PAGE_VERTICES, count));
+    auto &blocks = m_Pages[p].freeBlocks;
+    blocks.clear();
+    if (m_Pages[p].capacity > count)
+      blocks[count] = m_Pages[p].capacity - count;
+    alloc.page = p;
+    alloc.first = 0;
+    alloc.count = count;
+  }
+
+  return alloc;
+}
+
+void ChunkMeshArena::Free(ArenaAllocation &alloc) {
+  if (!alloc.valid())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto &blocks = m_Pages[alloc.page].freeBlocks;
+    int offset = alloc.first;
+    int size = alloc.count;
+
+    // Coalesce with the following block
+    auto next = blocks.find(offset + size);
+    if (next != blocks.end()) {
+      size += next->second;
+      blocks.erase(next);
+    }
+
+    // Coalesce with the preceding block
+    auto it = blocks.lower_bound(offset);
+    if (it != blocks.begin()) {
+      auto prev = std::prev(it);
+      if (prev->first + prev->second == offset) {
+        prev->second += size;
+        offset = -1;
+      }
+    }
+    if (offset >= 0)
+      blocks[offset] = size;
+  }
+
+  alloc = ArenaAllocation();
+}
+
+void ChunkMeshArena::Upload(const ArenaAllocation &alloc, int offset,
+                            const float *data, int count) {
+  if (!alloc.valid() || count <= 0)
+    return;
+
+  size_t vertexBytes = FLOATS_PER_VERTEX * sizeof(float);
+  glBindBuffer(GL_ARRAY_BUFFER, m_Pages[alloc.page].VBO);
+  glBufferSubData(GL_ARRAY_BUFFER, (alloc.first + offset) * vertexBytes,
+                  count * vertexBytes, data);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void ChunkMeshArena::Draw(const std::vector<ChunkDraw> &draws) {
+  if (draws.empty())
+    return;
+  InitGL();
+
+  if (m_UseIndirect) {
+    m_Origins.resize(draws.size());
+    m_Commands.resize(draws.size());
+    for (size_t i = 0; i < draws.size(); ++i) {
+      m_Origins[i] = draws[i].origin;
+      m_Commands[i] = {(GLuint)draws[i].count, 1, (GLuint)draws[i].first,
+                       (GLuint)i};
+    }
+
+    // Orphan and refill both per-pass buffers
+    glBindBuffer(GL_ARRAY_BUFFER, m_OriginBuffer);
+    glBufferData(GL_ARRAY_BUFFER, m_Origins.size() * sizeof(glm::vec3),
+                 m_Origins.data(), GL_STREAM_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_IndirectBuffer);
+    glBufferData(GL_DRAW_INDIRECT_BUFFER,
+                 m_Commands.size() * sizeof(DrawArraysIndirectCommand),
+                 m_Commands.data(), GL_STREAM_DRAW);
+  }
+
+  // Submit runs of consecutive draws from the same page so the caller's
+  // ordering (front-to-back / back-to-front) is preserved
+  size_t start = 0;
+  while (start < draws.size()) {
+    size_t end = start + 1;
+    while (end < draws.size() && draws[end].page == draws[start].page)
+      ++end;
+
+    glBindVertexArray(m_Pages[draws[start].page].VAO);
+    if (m_UseIndirect) {
+      glMultiDrawArraysIndirect(
+          GL_TRIANGLES,
+          (const void *)(start * sizeof(DrawArraysIndirectCommand)),
+          (GLsizei)(end - start), 0);
+    } else {
+      for (size_t i = start; i < end; ++i) {
+        const ChunkDraw &d = draws[i];
+        glVertexAttrib3f(5, d.origin.x, d.origin.y, d.origin.z);
+        glDrawArrays(GL_TRIANGLES, d.first, d.count);
+      }
+    }
+    start = end;
+  }
+
+  glBindVertexArray(0);
+  if (m_UseIndirect) {
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+  } else {
+    // The constant attribute is context state; don't leak an offset into
+    // other draws using the same shader
+    glVertexAttrib3f(5, 0.0f, 0.0f, 0.0f);
+  }
+}
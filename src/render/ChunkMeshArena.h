@@ -0,0 +1,91 @@
+#ifndef CHUNK_MESH_ARENA_H
+#define CHUNK_MESH_ARENA_H
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <map>
+#include <mutex>
+#include <vector>
+
+// A range of vertices inside one arena page
+struct ArenaAllocation {
+  int page = -1;
+  int first = 0; // First vertex in the page
+  int count = 0;
+
+  bool valid() const { return page >= 0; }
+};
+
+// One chunk mesh range to draw, positioned by its chunk origin
+struct ChunkDraw {
+  int page;
+  int first;
+  int count;
+  glm::vec3 origin;
+};
+
+// Sub-allocates every chunk mesh out of a few large vertex buffers ("pages")
+// using a first-fit free list per page. All pages share the chunk vertex
+// layout, so a whole pass is drawn with one VAO bind per page and the chunk
+// origin is supplied per draw through attribute 5 instead of a model matrix.
+//
+// With ARB_multi_draw_indirect + ARB_base_instance a pass is submitted as one
+// glMultiDrawArraysIndirect per page, the origin coming from an instanced
+// array indexed by baseInstance. Otherwise (plain GL 3.3) each draw sets the
+// origin as a constant attribute and calls glDrawArrays on the bound page.
+class ChunkMeshArena {
+public:
+  static const int FLOATS_PER_VERTEX = 14;
+  static const int PAGE_VERTICES = 1 << 18; // ~14 MB per page
+
+  ChunkMeshArena();
+  ~ChunkMeshArena();
+
+  // Main thread only (may create GL buffers). count == 0 returns an invalid
+  // allocation.
+  ArenaAllocation Allocate(int count);
+  // Safe from any thread; the range becomes reusable immediately
+  void Free(ArenaAllocation &alloc);
+
+  // Main thread only. 'offset' is in vertices relative to alloc.first
+  void Upload(const ArenaAllocation &alloc, int offset, const float *data,
+              int count);
+
+  // Main thread only. Draws are submitted in the given order.
+  void Draw(const std::vector<ChunkDraw> &draws);
+
+  bool UsesIndirect() const { return m_UseIndirect; }
+  size_t GetPageCount() const { return m_Pages.size(); }
+
+private:
+  struct Page {
+    unsigned int VAO = 0;
+    unsigned int VBO = 0;
+    int capacity = 0;
+    std::map<int, int> freeBlocks; // Offset -> size, in vertices
+  };
+
+  struct DrawArraysIndirectCommand {
+    GLuint count;
+    GLuint instanceCount;
+    GLuint first;
+    GLuint baseInstance;
+  };
+
+  void InitGL();
+  int CreatePage(int capacity); // Caller must hold m_Mutex
+
+  std::vector<Page> m_Pages;
+  std::mutex m_Mutex;
+
+  bool m_GLReady = false;
+  bool m_UseIndirect = false;
+  unsigned int m_OriginBuffer = 0;
+  unsigned int m_IndirectBuffer = 0;
+
+  // Per-pass scratch, reused between frames
+  std::vector<glm::vec3> m_Origins;
+  std::vector<DrawArraysIndirectCommand> m_Commands;
+};
+
+#endif
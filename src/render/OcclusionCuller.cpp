@@ -0,0 +1,294 @@
+#include "OcclusionCuller.h"
+#include "../debug/Profiler.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+// Anything closer than this (in clip w) is treated as crossing the near plane
+static const float NEAR_W = 0.1f;
+
+// Corner indices (bit0 = x, bit1 = y, bit2 = z) of the 6 box faces, in order
+// -X, +X, -Y, +Y, -Z, +Z
+static const int BOX_FACES[6][4] = {{0, 2, 6, 4}, {1, 3, 7, 5}, {0, 1, 5, 4},
+                                    {2, 3, 7, 6}, {0, 1, 3, 2}, {4, 5, 7, 6}};
+
+OcclusionCuller::OcclusionCuller() {
+  for (int l = 0; l < LEVELS; ++l)
+    m_Levels[l].assign((WIDTH >> l) * (HEIGHT >> l), FLT_MAX);
+}
+
+OcclusionCuller::~OcclusionCuller() {
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Shutdown = true;
+  }
+  m_Condition.notify_all();
+  if (m_Thread.joinable())
+    m_Thread.join();
+}
+
+void OcclusionCuller::Begin(const glm::mat4 &viewProjection,
+                            const glm::vec3 &cameraPos,
+                            std::vector<OccluderBox> &&occluders) {
+  // Worlds that are never rendered (e.g. headless benchmarks) never start one
+  if (!m_Thread.joinable())
+    m_Thread = std::thread(&OcclusionCuller::WorkerLoop, this);
+
+  {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    // Never overwrite inputs the worker is still reading
+    m_Condition.wait(lock, [this] { return m_Ready; });
+    m_ViewProjection = viewProjection;
+    m_CameraPos = cameraPos;
+    m_Occluders = std::move(occluders);
+    m_HasWork = true;
+    m_Ready = false;
+  }
+  m_Condition.notify_all();
+}
+
+void OcclusionCuller::Wait() {
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  m_Condition.wait(lock, [this] { return m_Ready; });
+}
+
+void OcclusionCuller::WorkerLoop() {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(m_Mutex);
+      m_Condition.wait(lock, [this] { return m_HasWork || m_Shutdown; });
+      if (m_Shutdown)
+        break;
+      m_HasWork = false;
+    }
+
+    // The main thread only touches the buffers again after Wait()
+    Rasterize();
+
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      m_Ready = true;
+    }
+    m_Condition.notify_all();
+  }
+}
+
+void OcclusionCuller::Rasterize() {
+  PROFILE_SCOPE("Occlusion Raster");
+  std::fill(m_Levels[0].begin(), m_Levels[0].end(), FLT_MAX);
+
+  for (const OccluderBox &box : m_Occluders)
+    RasterizeBox(box);
+
+  BuildHiZ();
+}
+
+void OcclusionCuller::RasterizeBox(const OccluderBox &box) {
+  glm::vec4 clip[8];
+  for (int i = 0; i < 8; ++i) {
+    glm::vec3 p((i & 1) ? box.max.x : box.min.x,
+                (i & 2) ? box.max.y : box.min.y,
+                (i & 4) ? box.max.z : box.min.z);
+    clip[i] = m_ViewProjection * glm::vec4(p, 1.0f);
+  }
+
+  // Only faces pointing at the camera can be the nearest surface
+  int faces[3];
+  int faceCount = 0;
+  int cornerMask = 0;
+  for (int axis = 0; axis < 3; ++axis) {
+    int face;
+    if (m_CameraPos[axis] < box.min[axis])
+      face = axis * 2;
+    else if (m_CameraPos[axis] > box.max[axis])
+      face = axis * 2 + 1;
+    else
+      continue;
+    faces[faceCount++] = face;
+    for (int k = 0; k < 4; ++k)
+      cornerMask |= 1 << BOX_FACES[face][k];
+  }
+  if (faceCount == 0)
+    return;
+
+  bool inFront = true;
+  for (int i = 0; i < 8; ++i)
+    inFront &= clip[i].w >= NEAR_W;
+
+  if (inFront) {
+    // The facing faces project to the box's silhouette, so fill it as one
+    // polygon: separate faces would leave unfilled texels along the edges
+    // they share. Flat depth at their farthest corner keeps it conservative.
+    glm::vec2 points[8];
+    float depth = 0.0f;
+    for (int i = 0; i < 8; ++i) {
+      points[i] = ToScreen(clip[i]);
+      if (cornerMask & (1 << i))
+        depth = std::max(depth, clip[i].w);
+    }
+    RasterizeConvex(points, 8, depth);
+    return;
+  }
+
+  // Occluders crossing the near plane are not clipped; only the facing
+  // faces entirely in front of it are kept
+  for (int f = 0; f < faceCount; ++f) {
+    const int *q = BOX_FACES[faces[f]];
+    glm::vec2 points[4];
+    float depth = 0.0f;
+    bool faceInFront = true;
+    for (int k = 0; k < 4; ++k) {
+      faceInFront &= clip[q[k]].w >= NEAR_W;
+      points[k] = ToScreen(clip[q[k]]);
+      depth = std::max(depth, clip[q[k]].w);
+    }
+    if (faceInFront)
+      RasterizeConvex(points, 4, depth);
+  }
+}
+
+glm::vec2 OcclusionCuller::ToScreen(const glm::vec4 &c) {
+  return glm::vec2((c.x / c.w * 0.5f + 0.5f) * WIDTH,
+                   (c.y / c.w * 0.5f + 0.5f) * HEIGHT);
+}
+
+void OcclusionCuller::RasterizeConvex(const glm::vec2 *points, int count,
+                                      float depth) {
+  // Counter-clockwise convex hull (monotone chain), so every edge function
+  // is non-negative inside whatever order the points came in
+  glm::vec2 sorted[8];
+  std::copy(points, points + count, sorted);
+  std::sort(sorted, sorted + count, [](const glm::vec2 &a, const glm::vec2 &b) {
+    return a.x < b.x || (a.x == b.x && a.y < b.y);
+  });
+  auto cross = [](const glm::vec2 &o, const glm::vec2 &a, const glm::vec2 &b) {
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+  };
+  glm::vec2 hull[16];
+  int n = 0;
+  for (int i = 0; i < count; ++i) {
+    while (n >= 2 && cross(hull[n - 2], hull[n - 1], sorted[i]) <= 0.0f)
+      --n;
+    hull[n++] = sorted[i];
+  }
+  for (int i = count - 2, lower = n + 1; i >= 0; --i) {
+    while (n >= lower && cross(hull[n - 2], hull[n - 1], sorted[i]) <= 0.0f)
+      --n;
+    hull[n++] = sorted[i];
+  }
+  n--; // Last point repeats the first
+  if (n < 3)
+    return;
+
+  float minXf = FLT_MAX, maxXf = -FLT_MAX, minYf = FLT_MAX, maxYf = -FLT_MAX;
+  for (int i = 0; i < n; ++i) {
+    minXf = std::min(minXf, hull[i].x);
+    maxXf = std::max(maxXf, hull[i].x);
+    minYf = std::min(minYf, hull[i].y);
+    maxYf = std::max(maxYf, hull[i].y);
+  }
+  int minX = std::max(0, (int)std::floor(minXf));
+  int maxX = std::min(WIDTH - 1, (int)std::ceil(maxXf));
+  int minY = std::max(0, (int)std::floor(minYf));
+  int maxY = std::min(HEIGHT - 1, (int)std::ceil(maxYf));
+  if (minX > maxX || minY > maxY)
+    return;
+
+  // Edge functions at texel centres, stepped along x. Each is pulled in by
+  // its largest change over half a texel, so a texel only passes if all four
+  // of its corners are inside: anything poking past the silhouette, however
+  // slightly, still lands on an unfilled texel in IsVisible.
+  float dx[8], dy[8], bias[8];
+  for (int i = 0; i < n; ++i) {
+    const glm::vec2 &a = hull[i];
+    const glm::vec2 &b = hull[(i + 1) % n];
+    dx[i] = -(b.y - a.y);
+    dy[i] = b.x - a.x;
+    bias[i] = 0.5f * (std::abs(dx[i]) + std::abs(dy[i]));
+  }
+
+  float px = minX + 0.5f;
+  std::vector<float> &buffer = m_Levels[0];
+  for (int y = minY; y <= maxY; ++y) {
+    float py = y + 0.5f;
+    float e[8];
+    for (int i = 0; i < n; ++i)
+      e[i] = dy[i] * (py - hull[i].y) + dx[i] * (px - hull[i].x) - bias[i];
+
+    float *row = &buffer[y * WIDTH];
+    for (int x = minX; x <= maxX; ++x) {
+      float fx = (float)(x - minX);
+      bool inside = true;
+      for (int i = 0; i < n; ++i)
+        inside &= e[i] + fx * dx[i] >= 0.0f;
+      if (inside)
+        row[x] = std::min(row[x], depth);
+    }
+  }
+}
+
+void OcclusionCuller::BuildHiZ() {
+  for (int l = 1; l < LEVELS; ++l) {
+    const std::vector<float> &src = m_Levels[l - 1];
+    std::vector<float> &dst = m_Levels[l];
+    int srcW = WIDTH >> (l - 1);
+    int w = WIDTH >> l;
+    int h = HEIGHT >> l;
+    for (int y = 0; y < h; ++y) {
+      const float *r0 = &src[(y * 2) * srcW];
+      const float *r1 = r0 + srcW;
+      float *out = &dst[y * w];
+      for (int x = 0; x < w; ++x) {
+        out[x] = std::max(std::max(r0[x * 2], r0[x * 2 + 1]),
+                          std::max(r1[x * 2], r1[x * 2 + 1]));
+      }
+    }
+  }
+}
+
+bool OcclusionCuller::IsVisible(const glm::vec3 &min,
+                                const glm::vec3 &max) const {
+  float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+  float minW = FLT_MAX;
+  for (int i = 0; i < 8; ++i) {
+    glm::vec3 p((i & 1) ? max.x : min.x, (i & 2) ? max.y : min.y,
+                (i & 4) ? max.z : min.z);
+    glm::vec4 c = m_ViewProjection * glm::vec4(p, 1.0f);
+    if (c.w < NEAR_W)
+      return true; // Touches the near plane, can't be hidden
+    float sx = (c.x / c.w * 0.5f + 0.5f) * WIDTH;
+    float sy = (c.y / c.w * 0.5f + 0.5f) * HEIGHT;
+    minX = std::min(minX, sx);
+    maxX = std::max(maxX, sx);
+    minY = std::min(minY, sy);
+    maxY = std::max(maxY, sy);
+    minW = std::min(minW, c.w);
+  }
+
+  // Off-screen boxes are the frustum test's job
+  if (maxX < 0.0f || maxY < 0.0f || minX >= WIDTH || minY >= HEIGHT)
+    return true;
+
+  int x0 = std::max(0, (int)std::floor(minX));
+  int x1 = std::min(WIDTH - 1, (int)std::floor(maxX));
+  int y0 = std::max(0, (int)std::floor(minY));
+  int y1 = std::min(HEIGHT - 1, (int)std::floor(maxY));
+
+  // Pick the mip where the rectangle covers only a handful of texels
+  int level = 0;
+  int span = std::max(x1 - x0, y1 - y0) + 1;
+  while (span > 4 && level < LEVELS - 1) {
+    span = (span + 1) / 2;
+    ++level;
+  }
+
+  const std::vector<float> &buffer = m_Levels[level];
+  int w = WIDTH >> level;
+  for (int y = y0 >> level; y <= (y1 >> level); ++y) {
+    for (int x = x0 >> level; x <= (x1 >> level); ++x) {
+      if (buffer[y * w + x] >= minW)
+        return true;
+    }
+  }
+  return false;
+}
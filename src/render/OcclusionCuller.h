@@ -0,0 +1,64 @@
+#ifndef OCCLUSION_CULLER_H
+#define OCCLUSION_CULLER_H
+
+#include <condition_variable>
+#include <glm/glm.hpp>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// World-space box that is guaranteed to be fully opaque
+struct OccluderBox {
+  glm::vec3 min;
+  glm::vec3 max;
+};
+
+// Low resolution CPU depth rasteriser used to reject chunks hidden behind
+// terrain. Occluders are rasterised on a worker thread, started by the
+// first Begin(), into a linear-depth buffer (clip w, farthest value per
+// occluder, and only texels the occluder covers completely, so the result
+// stays conservative), which is then reduced into a max-depth pyramid for
+// testing.
+class OcclusionCuller {
+public:
+  static const int WIDTH = 256;
+  static const int HEIGHT = 128;
+  static const int LEVELS = 6; // 256x128 down to 8x4
+
+  OcclusionCuller();
+  ~OcclusionCuller();
+
+  // Starts rasterising 'occluders' for this frame on the worker thread.
+  // Called from one thread only.
+  void Begin(const glm::mat4 &viewProjection, const glm::vec3 &cameraPos,
+             std::vector<OccluderBox> &&occluders);
+  // Blocks until the depth pyramid for the last Begin() is ready
+  void Wait();
+
+  // Conservative: returns false only if the box is completely hidden
+  bool IsVisible(const glm::vec3 &min, const glm::vec3 &max) const;
+
+private:
+  void WorkerLoop();
+  void Rasterize();
+  void RasterizeBox(const OccluderBox &box);
+  // Fills, at flat 'depth', the texels lying entirely inside the convex
+  // hull of 'points' (screen space, at most 8)
+  void RasterizeConvex(const glm::vec2 *points, int count, float depth);
+  static glm::vec2 ToScreen(const glm::vec4 &clip);
+  void BuildHiZ();
+
+  std::vector<float> m_Levels[LEVELS]; // Level 0 is full resolution
+  glm::mat4 m_ViewProjection{1.0f};
+  glm::vec3 m_CameraPos{0.0f};
+  std::vector<OccluderBox> m_Occluders;
+
+  std::thread m_Thread;
+  std::mutex m_Mutex;
+  std::condition_variable m_Condition;
+  bool m_HasWork = false;
+  bool m_Ready = true;
+  bool m_Shutdown = false;
+};
+
+#endif
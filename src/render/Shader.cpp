@@ -60,6 +60,7 @@ Shader::Shader(const std::filesystem::path &vertexPath,
   glAttachShader(ID, fragment);
   glLinkProgram(ID);
   checkCompileErrors(ID, "PROGRAM");
+  cacheUniformLocations();
 
   // delete the shaders as they're linked into our program now and no longer
   // necessary
@@ -72,35 +73,62 @@ Shader::Shader(const std::filesystem::path &vertexPath,
 
 void Shader::use() { glUseProgram(ID); }
 
+void Shader::cacheUniformLocations() {
+  // Resolve every active uniform once so setters never hit the driver's
+  // string lookup
+  uniformLocations.clear();
+  int count = 0;
+  glGetProgramiv(ID, GL_ACTIVE_UNIFORMS, &count);
+  char name[256];
+  for (int i = 0; i < count; ++i) {
+    GLsizei length = 0;
+    GLint size = 0;
+    GLenum type = 0;
+    glGetActiveUniform(ID, (GLuint)i, sizeof(name), &length, &size, &type,
+                       name);
+    std::string uniformName(name, length);
+    // Arrays are reported as "name[0]"; make the bare name resolve too
+    size_t bracket = uniformName.find('[');
+    if (bracket != std::string::npos)
+      uniformName = uniformName.substr(0, bracket);
+    uniformLocations[uniformName] =
+        glGetUniformLocation(ID, uniformName.c_str());
+  }
+}
+
+int Shader::getUniformLocation(const std::string &name) const {
+  auto it = uniformLocations.find(name);
+  return it != uniformLocations.end() ? it->second : -1;
+}
+
 void Shader::setBool(const std::string &name, bool value) const {
-  glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)value);
+  glUniform1i(getUniformLocation(name), (int)value);
 }
 void Shader::setInt(const std::string &name, int value) const {
-  glUniform1i(glGetUniformLocation(ID, name.c_str()), value);
+  glUniform1i(getUniformLocation(name), value);
 }
 void Shader::setFloat(const std::string &name, float value) const {
-  glUniform1f(glGetUniformLocation(ID, name.c_str()), value);
+  glUniform1f(getUniformLocation(name), value);
 }
 
 void Shader::setVec3(const std::string &name, const glm::vec3 &value) const {
-  glUniform3fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+  glUniform3fv(getUniformLocation(name), 1, &value[0]);
 }
 
 void Shader::setVec3(const std::string &name, float x, float y, float z) const {
-  glUniform3f(glGetUniformLocation(ID, name.c_str()), x, y, z);
+  glUniform3f(getUniformLocation(name), x, y, z);
 }
 
 void Shader::setVec2(const std::string &name, const glm::vec2 &value) const {
-  glUniform2fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
+  glUniform2fv(getUniformLocation(name), 1, &value[0]);
 }
 
 void Shader::setVec2(const std::string &name, float x, float y) const {
-  glUniform2f(glGetUniformLocation(ID, name.c_str()), x, y);
+  glUniform2f(getUniformLocation(name), x, y);
 }
 
 void Shader::setMat4(const std::string &name, const glm::mat4 &mat) const {
-  glUniformMatrix4fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE,
-                     &mat[0][0]);
+  glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, &mat[0][0]);
 }
 
 void Shader::checkCompileErrors(unsigned int shader, std::string type) {
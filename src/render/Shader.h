@@ -6,10 +6,18 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include <GL/glew.h>
 #include <glm/glm.hpp>
 
+// Uniform location resolved once after linking. The type parameter only
+// selects the matching Shader::set overload.
+template <typename T> struct UniformHandle {
+  int location = -1;
+  bool valid() const { return location >= 0; }
+};
+
 class Shader {
 public:
   unsigned int ID;
@@ -28,8 +36,38 @@ public:
   void setVec2(const std::string &name, float x, float y) const;
   void setMat4(const std::string &name, const glm::mat4 &mat) const;
 
+  // Cached location lookup (no driver call). -1 if the uniform is inactive.
+  int getUniformLocation(const std::string &name) const;
+  template <typename T>
+  UniformHandle<T> getUniform(const std::string &name) const {
+    return UniformHandle<T>{getUniformLocation(name)};
+  }
+
+  // Typed setters for hot paths; the program must be in use
+  void set(UniformHandle<bool> u, bool value) const {
+    glUniform1i(u.location, (int)value);
+  }
+  void set(UniformHandle<int> u, int value) const {
+    glUniform1i(u.location, value);
+  }
+  void set(UniformHandle<float> u, float value) const {
+    glUniform1f(u.location, value);
+  }
+  void set(UniformHandle<glm::vec2> u, const glm::vec2 &value) const {
+    glUniform2fv(u.location, 1, &value[0]);
+  }
+  void set(UniformHandle<glm::vec3> u, const glm::vec3 &value) const {
+    glUniform3fv(u.location, 1, &value[0]);
+  }
+  void set(UniformHandle<glm::mat4> u, const glm::mat4 &mat) const {
+    glUniformMatrix4fv(u.location, 1, GL_FALSE, &mat[0][0]);
+  }
+
 private:
   void checkCompileErrors(unsigned int shader, std::string type);
+  void cacheUniformLocations();
+
+  std::unordered_map<std::string, int> uniformLocations;
 };
 
 #endif
@@ -4,6 +4,8 @@ layout (location = 1) in vec4 aColor;
 layout (location = 2) in vec2 aTexCoord;
 layout (location = 3) in vec3 aLight;
 layout (location = 4) in vec2 aTexOrigin;
+layout (location = 5) in vec3 aOrigin; // Chunk origin per draw / entity position per instance
+layout (location = 6) in vec3 aInstanceScale; // Instanced entities only
 
 out vec4 ourColor;
 out vec2 TexCoord;
@@ -14,10 +16,15 @@ out vec3 FragPos;
 uniform mat4 model;
 uniform mat4 view;
 uniform mat4 projection;
+uniform bool useInstancing;
 
 void main()
 {
-    vec4 worldPos = model * vec4(aPos, 1.0);
+    vec4 worldPos;
+    if (useInstancing)
+        worldPos = vec4(aPos * aInstanceScale + aOrigin, 1.0);
+    else
+        worldPos = model * vec4(aPos + aOrigin, 1.0);
     gl_Position = projection * view * worldPos;
     FragPos = vec3(worldPos);
     ourColor = aColor;
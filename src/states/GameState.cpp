@@ -521,8 +521,9 @@ void GameState::Render(Application *app) {
   // Basic Render
   {
     PROFILE_SCOPE("Render Chunks");
-    app->GetWorld()->render(*m_Shader, cullMatrix, app->GetCamera().Position,
-                            m_DbgRenderDistance);
+    m_DbgRenderedChunks =
+        app->GetWorld()->render(*m_Shader, cullMatrix,
+                                app->GetCamera().Position, m_DbgRenderDistance);
   }
 
   if (m_DbgWireframe)
@@ -790,6 +791,13 @@ void GameState::RenderUI(Application *app) {
     }
     ImGui::SliderInt("Simulation Dist", &m_DbgSimulationDistance, 1, 16);
     ImGui::Text("Chunks Loaded: %zu", app->GetWorld()->getChunkCount());
+    ImGui::Text("Chunks Rendered: %d", m_DbgRenderedChunks);
+    ImGui::Checkbox("Cave Culling", &app->GetWorld()->caveCulling);
+    ImGui::SameLine();
+    ImGui::Text("(%d culled)", app->GetWorld()->lastCaveCulled);
+    ImGui::Checkbox("Occlusion Culling", &app->GetWorld()->occlusionCulling);
+    ImGui::SameLine();
+    ImGui::Text("(%d culled)", app->GetWorld()->lastOcclusionCulled);
     ImGui::SliderFloat("Gravity", &gravity.strength, 0.0f, 50.0f);
     ImGui::SameLine();
     ImGui::Checkbox("Freeze Culling", &m_DbgFreezeCulling);
@@ -7,14 +7,23 @@
 #include "backends/imgui_impl_opengl3.h"
 #include "imgui.h"
 #include <GLFW/glfw3.h>
+#include <cstdio>
 
 LoadingState::LoadingState(const WorldGenConfig &config) : m_Config(config) {}
 
 void LoadingState::Init(Application *app) {
   LOG_INFO("Entering Loading State");
 
-  // Re-initialize World with our new config
-  app->SetWorld(std::make_unique<World>(m_Config));
+  // Re-initialize World with our new config. Edits are saved per seed and
+  // generator settings, so changing either starts a fresh world.
+  char saveDirectory[64];
+  snprintf(saveDirectory, sizeof(saveDirectory), "saves/%d_%016llx",
+           m_Config.seed,
+           (unsigned long long)HashWorldGenConfig(m_Config));
+  WorldOptions options;
+  options.saveDirectory = saveDirectory;
+  options.columnCacheDirectory = app->GetConfig().columnCacheDirectory;
+  app->SetWorld(std::make_unique<World>(m_Config, options));
 
   glfwSetInputMode(app->GetWindow(), GLFW_CURSOR, GLFW_CURSOR_NORMAL);
 
@@ -78,7 +78,9 @@ void MenuState::UpdatePreview3D() {
   bool useBenchmark = !m_BenchmarkChunks.empty();
   if (!m_PreviewWorld || m_PreviewWorld->worldSeed != m_Config.seed ||
       useBenchmark) {
-    m_PreviewWorld = std::make_unique<World>(m_Config);
+    WorldOptions options;
+    options.columnCacheDirectory = m_ColumnCacheDirectory;
+    m_PreviewWorld = std::make_unique<World>(m_Config, options);
 
     if (useBenchmark) {
       for (auto &c : m_BenchmarkChunks) {
@@ -148,6 +150,7 @@ void MenuState::Init(Application *app) {
 
   // Inherit seed from app config (allows CLI to work)
   m_Config.seed = app->GetConfig().seed;
+  m_ColumnCacheDirectory = app->GetConfig().columnCacheDirectory;
   m_ConfigName[0] = '\0';
   LoadConfig("default"); // Try load default
 
@@ -190,35 +193,46 @@ void MenuState::Init(Application *app) {
 
 void MenuState::UpdatePreview() {
   WorldGenerator tempGen(m_Config);
+
+  // Heights along the preview row (x = 0..510, z = 0) come from one batched
+  // grid per curve; the plots use every fourth sample
+  const int ROW = 512;
+  std::vector<int> heights(ROW);
+  tempGen.GenerateHeightMap(heights.data(), 0, 0, ROW, 1);
+  const char *landformNames[5] = {"oceans", "valleys", "plains", "hills",
+                                  "mountains"};
+  float *landformData[5] = {m_OceansData, m_ValleysData, m_PlainsData,
+                            m_HillsData, m_MountainsData};
+  std::vector<int> landformHeights(ROW);
+  for (int l = 0; l < 5; ++l) {
+    tempGen.GenerateLandformHeightMap(landformNames[l], landformHeights.data(),
+                                      0, 0, ROW, 1);
+    for (int idx = 0; idx < 128; ++idx)
+      landformData[l][idx] = (float)landformHeights[idx * 4];
+  }
+
   for (int i = 0; i < 256; ++i) {
     int x = i * 2; // More resolution, smaller step
     int z = 0;
-    int height = tempGen.GetHeight(x, z);
 
     // Populate main preview data (128 samples for compatibility with old plots
     // if needed, but we use 256 for the new cave slice)
     if (i % 2 == 0) {
       int idx = i / 2;
+      int height = heights[x];
       m_PreviewData[idx] = (float)height;
       m_TempData[idx] = tempGen.GetTemperature(x, z, height);
       m_HumidData[idx] = tempGen.GetHumidity(x, z);
       m_BiomeData[idx] = (float)tempGen.GetBiomeAtHeight(x, z, height);
       m_CaveProbData[idx] = tempGen.GetCaveProbability(x, z);
-
-      // Sample individual landforms
-      m_OceansData[idx] = (float)tempGen.GetHeightForLandform("oceans", x, z);
-      m_ValleysData[idx] = (float)tempGen.GetHeightForLandform("valleys", x, z);
-      m_PlainsData[idx] = (float)tempGen.GetHeightForLandform("plains", x, z);
-      m_HillsData[idx] = (float)tempGen.GetHeightForLandform("hills", x, z);
-      m_MountainsData[idx] =
-          (float)tempGen.GetHeightForLandform("mountains", x, z);
     }
 
     // Sample 2D cave slice (X: 256, Y: 128)
     for (int j = 0; j < 128; ++j) {
       // Map j [0, 127] to height [0, worldHeight]
       int y = (int)((float)j / 128.0f * (float)m_Config.worldHeight);
-      m_CaveSliceData[i + j * 256] = tempGen.IsCaveAt(x, y, 0) ? 1.0f : 0.0f;
+      m_CaveSliceData[i + j * 256] =
+          tempGen.IsCaveAt(x, y, 0, heights[x]) ? 1.0f : 0.0f;
     }
   }
 
@@ -436,7 +450,8 @@ void MenuState::RenderUI(Application *app) {
         if (ImGui::Button("Run Benchmark")) {
           // Close config window to let benchmark run (optional, but cleaner)
           // Actually, we show a popup, so it's fine.
-          StartBenchmarkAsync(m_Config, m_BenchmarkSize);
+          StartBenchmarkAsync(m_Config, m_BenchmarkSize,
+                              m_ColumnCacheDirectory);
           ImGui::OpenPopup("Running Benchmark...");
         }
 
@@ -26,6 +26,7 @@ private:
   void LoadConfig(const std::string &name);
 
   WorldGenConfig m_Config;
+  std::string m_ColumnCacheDirectory; // From the app config; empty = off
   char m_ConfigName[64] = "default_preset";
   char m_SeedBuffer[32];
   float m_PreviewData[128];
@@ -1,16 +1,17 @@
 #include "Chunk.h"
+#include "ChunkColumn.h"
 #include "World.h"
 #include "WorldGenerator.h"
+#include <bitset>
 #include <cmath>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtx/norm.hpp>
-#include <queue>
 #include <tuple>
 
 Chunk::Chunk()
     : meshDirty(true), vertexCount(0), vertexCountTransparent(0),
-      chunkPosition(0, 0, 0), world(nullptr), VAO(0), VBO(0), EBO(0) {
-  // GL initialization deferred to Main Thread via initGL()
+      chunkPosition(0, 0, 0), world(nullptr) {
+  // GPU storage is allocated from the world's mesh arena on first upload
   // Initialize with air
   Block *air = BlockRegistry::getInstance().getBlock(AIR);
   for (int x = 0; x < CHUNK_SIZE; ++x)
@@ -20,48 +21,34 @@ Chunk::Chunk()
 
   for (int i = 0; i < 6; ++i)
     neighbors[i] = nullptr;
+
+  occluderHeights[0].store(0);
+  occluderHeights[1].store(0);
 }
 
 Chunk::~Chunk() {
-  glDeleteVertexArrays(1, &VAO);
-  glDeleteBuffers(1, &VBO);
-  glDeleteBuffers(1, &EBO);
+  if (meshArena)
+    meshArena->Free(meshAlloc);
 }
 
 // ... Setters ...
 
-void Chunk::initGL() {
-  if (VAO == 0) {
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    glGenBuffers(1, &EBO);
-  }
-}
-
-void Chunk::render(Shader &shader, const glm::mat4 &viewProjection, int pass) {
-  if (VAO == 0)
-    initGL();
+void Chunk::appendDraw(std::vector<ChunkDraw> &draws, int pass) const {
   // Pass 0: Opaque
   // Pass 1: Transparent
-
+  if (!meshAlloc.valid())
+    return;
   if (pass == 0 && vertexCount == 0)
     return;
   if (pass == 1 && vertexCountTransparent == 0)
     return;
 
-  shader.setMat4(
-      "model",
-      glm::translate(glm::mat4(1.0f), glm::vec3(chunkPosition.x * CHUNK_SIZE,
-                                                chunkPosition.y * CHUNK_SIZE,
-                                                chunkPosition.z * CHUNK_SIZE)));
-
-  glBindVertexArray(VAO);
-  if (pass == 0) {
-    glDrawArrays(GL_TRIANGLES, 0, vertexCount);
-  } else {
-    glDrawArrays(GL_TRIANGLES, vertexCount, vertexCountTransparent);
-  }
-  glBindVertexArray(0);
+  ChunkDraw d;
+  d.page = meshAlloc.page;
+  d.first = meshAlloc.first + (pass == 0 ? 0 : vertexCount);
+  d.count = pass == 0 ? vertexCount : vertexCountTransparent;
+  d.origin = glm::vec3(chunkPosition * CHUNK_SIZE);
+  draws.push_back(d);
 }
 
 ChunkBlock Chunk::getBlock(int x, int y, int z) const {
@@ -1487,6 +1474,10 @@ std::vector<float> Chunk::generateGeometry(int &outOpaqueCount) {
     }
   }
 
+  // Culling data (blocks are already locked)
+  computeVisibility();
+  computeOccluders();
+
   // Stitch Vectors
   outOpaqueCount = opaqueVertices.size() / 14;
   opaqueVertices.insert(opaqueVertices.end(), transparentVertices.begin(),
@@ -1494,15 +1485,141 @@ std::vector<float> Chunk::generateGeometry(int &outOpaqueCount) {
 
   return opaqueVertices;
 }
+
+void Chunk::computeVisibility() {
+  // Flood fill every connected region of see-through voxels and record which
+  // chunk faces it touches. Any two faces touched by the same region can see
+  // each other.
+  constexpr int VOLUME = CHUNK_SIZE * CHUNK_SIZE * CHUNK_SIZE;
+  std::bitset<VOLUME> visited;
+  std::vector<int> stack;
+  stack.reserve(4096);
+
+  auto index = [](int x, int y, int z) {
+    return (x * CHUNK_SIZE + y) * CHUNK_SIZE + z;
+  };
+  auto occludes = [](const ChunkBlock &b) {
+    return b.isOpaque() && b.getRenderLayer() == Block::RenderLayer::OPAQUE;
+  };
+
+  uint64_t mask = 0;
+  for (int sx = 0; sx < CHUNK_SIZE; ++sx) {
+    for (int sy = 0; sy < CHUNK_SIZE; ++sy) {
+      for (int sz = 0; sz < CHUNK_SIZE; ++sz) {
+        int start = index(sx, sy, sz);
+        if (visited[start] || occludes(blocks[sx][sy][sz]))
+          continue;
+
+        int faces = 0;
+        visited[start] = true;
+        stack.push_back(start);
+        while (!stack.empty()) {
+          int idx = stack.back();
+          stack.pop_back();
+          int z = idx % CHUNK_SIZE;
+          int y = (idx / CHUNK_SIZE) % CHUNK_SIZE;
+          int x = idx / (CHUNK_SIZE * CHUNK_SIZE);
+
+          if (x == 0)
+            faces |= 1 << DIR_LEFT;
+          if (x == CHUNK_SIZE - 1)
+            faces |= 1 << DIR_RIGHT;
+          if (y == 0)
+            faces |= 1 << DIR_BOTTOM;
+          if (y == CHUNK_SIZE - 1)
+            faces |= 1 << DIR_TOP;
+          if (z == 0)
+            faces |= 1 << DIR_BACK;
+          if (z == CHUNK_SIZE - 1)
+            faces |= 1 << DIR_FRONT;
+
+          const int offsets[6][3] = {{1, 0, 0},  {-1, 0, 0}, {0, 1, 0},
+                                     {0, -1, 0}, {0, 0, 1},  {0, 0, -1}};
+          for (const auto &o : offsets) {
+            int nx = x + o[0];
+            int ny = y + o[1];
+            int nz = z + o[2];
+            if (nx < 0 || nx >= CHUNK_SIZE || ny < 0 || ny >= CHUNK_SIZE ||
+                nz < 0 || nz >= CHUNK_SIZE)
+              continue;
+            int nIdx = index(nx, ny, nz);
+            if (visited[nIdx] || occludes(blocks[nx][ny][nz]))
+              continue;
+            visited[nIdx] = true;
+            stack.push_back(nIdx);
+          }
+        }
+
+        for (int a = 0; a < 6; ++a) {
+          if (!(faces & (1 << a)))
+            continue;
+          for (int b = 0; b < 6; ++b) {
+            if (faces & (1 << b))
+              mask |= 1ULL << (a * 6 + b);
+          }
+        }
+
+        if (mask == ALL_FACES_VISIBLE)
+          break; // Nothing left to discover
+      }
+      if (mask == ALL_FACES_VISIBLE)
+        break;
+    }
+    if (mask == ALL_FACES_VISIBLE)
+      break;
+  }
+
+  visibilityMask.store(mask, std::memory_order_relaxed);
+}
+
+void Chunk::computeOccluders() {
+  // For every footprint tile count how many layers from the bottom are solid
+  // all the way across. These become conservative occluder boxes.
+  static_assert(OCCLUDER_TILES * OCCLUDER_TILES == 16,
+                "occluderHeights packs 16 tiles");
+  uint64_t packed[2] = {0, 0};
+  for (int tz = 0; tz < OCCLUDER_TILES; ++tz) {
+    for (int tx = 0; tx < OCCLUDER_TILES; ++tx) {
+      int h = 0;
+      for (int y = 0; y < CHUNK_SIZE; ++y) {
+        bool solid = true;
+        for (int x = tx * OCCLUDER_TILE; solid && x < (tx + 1) * OCCLUDER_TILE;
+             ++x) {
+          for (int z = tz * OCCLUDER_TILE; z < (tz + 1) * OCCLUDER_TILE; ++z) {
+            const ChunkBlock &b = blocks[x][y][z];
+            if (!b.isOpaque() ||
+                b.getRenderLayer() != Block::RenderLayer::OPAQUE) {
+              solid = false;
+              break;
+            }
+          }
+        }
+        if (!solid)
+          break;
+        h++;
+      }
+      int t = tx + tz * OCCLUDER_TILES;
+      packed[t >> 3] |= (uint64_t)h << ((t & 7) * 8);
+    }
+  }
+
+  occluderHeights[0].store(packed[0], std::memory_order_relaxed);
+  occluderHeights[1].store(packed[1], std::memory_order_relaxed);
+}
+
 void Chunk::uploadMesh(const std::vector<float> &data, int opaqueCount) {
-  if (VAO == 0)
-    initGL();
+  if (!meshArena) {
+    if (!world)
+      return;
+    meshArena = world->getMeshArena();
+  }
 
   // Upload to GPU (Main Thread)
-  glBindVertexArray(VAO);
-  glBindBuffer(GL_ARRAY_BUFFER, VBO);
-  glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(float), data.data(),
-               GL_DYNAMIC_DRAW);
+  // Reallocate the arena range; meshes change size on every rebuild
+  int totalVertices = (int)(data.size() / ChunkMeshArena::FLOATS_PER_VERTEX);
+  meshArena->Free(meshAlloc);
+  meshAlloc = meshArena->Allocate(totalVertices);
+  meshArena->Upload(meshAlloc, 0, data.data(), totalVertices);
 
   vertexCount = opaqueCount;
   vertexCountTransparent = (data.size() / 14) - opaqueCount;
@@ -1516,30 +1633,12 @@ void Chunk::uploadMesh(const std::vector<float> &data, int opaqueCount) {
   } else {
     transparentVertices.clear();
   }
-
-  // Attribs
-  float stride = 14 * sizeof(float);
-
-  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void *)0); // Pos
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, stride,
-                        (void *)(3 * sizeof(float))); // Color (Vec4)
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride,
-                        (void *)(7 * sizeof(float))); // UV
-  glEnableVertexAttribArray(2);
-  glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, stride,
-                        (void *)(9 * sizeof(float))); // Light(Sky,Block,AO)
-  glEnableVertexAttribArray(3);
-  glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, stride,
-                        (void *)(12 * sizeof(float))); // TexOrigin
-  glEnableVertexAttribArray(4);
 }
 
 void Chunk::sortAndUploadTransparent(const glm::vec3 &cameraPos) {
   if (vertexCountTransparent == 0)
     return;
-  if (VAO == 0)
+  if (!meshAlloc.valid())
     return;
 
   // Throttle: Only resort if camera moved significantly or never sorted
@@ -1548,12 +1647,31 @@ void Chunk::sortAndUploadTransparent(const glm::vec3 &cameraPos) {
   }
   m_lastSortCameraPos = cameraPos;
 
+  std::vector<float> sortedData;
+  sortTransparentFaces(transparentVertices,
+                       glm::vec3(chunkPosition * CHUNK_SIZE), cameraPos,
+                       sortedData);
+  if (sortedData.empty())
+    return;
+
+  // Upload to GPU (SubData)
+  // Transparent vertices follow the opaque ones in our arena range
+  meshArena->Upload(
+      meshAlloc, vertexCount, sortedData.data(),
+      (int)(sortedData.size() / ChunkMeshArena::FLOATS_PER_VERTEX));
+}
+
+void Chunk::sortTransparentFaces(const std::vector<float> &vertices,
+                                 const glm::vec3 &origin,
+                                 const glm::vec3 &cameraPos,
+                                 std::vector<float> &sorted) {
   int floatsPerVertex = 14; // As defined in uploadMesh
   int vertsPerFace = 6;
   int numFloatsPerFace = floatsPerVertex * vertsPerFace;
 
-  // transparentVertices stores FULL FACES consecutively.
-  int numFaces = transparentVertices.size() / numFloatsPerFace;
+  sorted.clear();
+  // vertices stores FULL FACES consecutively.
+  int numFaces = vertices.size() / numFloatsPerFace;
   if (numFaces == 0)
     return; // Should be covered by count check
 
@@ -1568,7 +1686,7 @@ void Chunk::sortAndUploadTransparent(const glm::vec3 &cameraPos) {
   // Calculate distances
   for (int i = 0; i < numFaces; ++i) {
     faces[i].index = i;
-    float *faceData = &transparentVertices[i * numFloatsPerFace];
+    const float *faceData = &vertices[i * numFloatsPerFace];
 
     // Calculate centroid (average of 6 vertices)
     glm::vec3 centroid(0.0f);
@@ -1580,10 +1698,7 @@ void Chunk::sortAndUploadTransparent(const glm::vec3 &cameraPos) {
     centroid /= (float)vertsPerFace;
 
     // Transform centroid to world space
-    glm::vec3 worldCentroid =
-        centroid + glm::vec3(chunkPosition.x * CHUNK_SIZE,
-                             chunkPosition.y * CHUNK_SIZE,
-                             chunkPosition.z * CHUNK_SIZE);
+    glm::vec3 worldCentroid = centroid + origin;
 
     faces[i].distSq = glm::distance2(worldCentroid, cameraPos);
   }
@@ -1594,24 +1709,13 @@ void Chunk::sortAndUploadTransparent(const glm::vec3 &cameraPos) {
       [](const FaceInfo &a, const FaceInfo &b) { return a.distSq > b.distSq; });
 
   // Reconstruct sorted buffer
-  std::vector<float> sortedData;
-  sortedData.reserve(transparentVertices.size());
+  sorted.reserve(vertices.size());
 
   for (const auto &f : faces) {
     int offset = f.index * numFloatsPerFace;
-    sortedData.insert(sortedData.end(), transparentVertices.begin() + offset,
-                      transparentVertices.begin() + offset + numFloatsPerFace);
+    sorted.insert(sorted.end(), vertices.begin() + offset,
+                  vertices.begin() + offset + numFloatsPerFace);
   }
-
-  // Upload to GPU (SubData)
-  // Offset = opaque vertex count * floats per vertex * sizeof(float)
-  glBindVertexArray(VAO);
-  glBindBuffer(GL_ARRAY_BUFFER, VBO);
-  glBufferSubData(GL_ARRAY_BUFFER,
-                  vertexCount * floatsPerVertex * sizeof(float),
-                  sortedData.size() * sizeof(float), sortedData.data());
-  glBindBuffer(GL_ARRAY_BUFFER, 0); // Unbind VBO
-  glBindVertexArray(0);
 }
 
 void Chunk::updateMesh() {
@@ -2016,115 +2120,17 @@ bool Chunk::raycast(glm::vec3 origin, glm::vec3 direction, float maxDist,
   return false;
 }
 
-void Chunk::calculateSunlight() {
-  std::lock_guard<std::mutex> lock(chunkMutex);
-  // 1. Reset Sky Light
-  for (int x = 0; x < CHUNK_SIZE; ++x)
-    for (int y = 0; y < CHUNK_SIZE; ++y)
-      for (int z = 0; z < CHUNK_SIZE; ++z)
-        blocks[x][y][z].skyLight = 0;
-
-  // 2. Sunlight Column Calculation (Y-Down)
+void Chunk::raiseSkyHeights() {
+  if (!column)
+    return;
   for (int x = 0; x < CHUNK_SIZE; ++x) {
     for (int z = 0; z < CHUNK_SIZE; ++z) {
-      // 2a. Determine if column start has access to sky
-      int gx = chunkPosition.x * CHUNK_SIZE + x;
-      int gz = chunkPosition.z * CHUNK_SIZE + z;
-
-      // 2a. Determine if column start has access to sky
-      // gx and gz are already declared above
-
-      bool exposedToSky = false; // Default false
-      int incomingLight = 0;
-
-      // FIX: Use World Heightmap to determine Sky Exposure independently of
-      // neighbors
-      if (world) {
-        int h = world->getHeight(gx, gz);
-        // Check top block of this column (y=31)
-        // Global Y of top block:
-        int topGY = chunkPosition.y * CHUNK_SIZE + (CHUNK_SIZE - 1);
-
-        if (topGY > h) {
-          exposedToSky = true;
-          incomingLight = 15;
-        }
-      }
-
-      // Fallback/Neighbor Logic
-      if (!exposedToSky) {
-        Chunk *current = this;
-
-        // Check neighbors[DIR_TOP]
-        if (current->neighbors[DIR_TOP]) {
-          Chunk *n = current->neighbors[DIR_TOP];
-
-          // Only check bottom face of neighbor for light
-          // We can't easily iterate neighbor columns without locking or
-          // overhead, but we can check the *bottom* block of the neighbor.
-          // Neighbor(x, 0, z)
-
-          int nLight = n->getSkyLight(
-              x, 0, z); // This might be stale if neighbor not updated?
-          // But if neighbor is above heightmap, it should be 15.
-
-          if (nLight == 15) {
-            exposedToSky = true;
-            incomingLight = 15;
-          } else {
-            incomingLight = nLight;
-            if (incomingLight > 0)
-              exposedToSky = true;
-          }
+      for (int y = CHUNK_SIZE - 1; y >= 0; --y) {
+        if (blocks[x][y][z].isOpaque()) {
+          column->raiseSkyHeight(x, z, chunkPosition.y * CHUNK_SIZE + y);
+          break;
         }
       }
-
-      // Fallback for "High Enough" if heightmap failed or N/A
-      if (!exposedToSky &&
-          chunkPosition.y >= 6) { // Increased from 4 to 6 (y=192) to be safe?
-        exposedToSky = true;
-        incomingLight = 15;
-      }
-
-      if (exposedToSky) {
-        int currentLight = incomingLight;
-        for (int y = CHUNK_SIZE - 1; y >= 0; --y) {
-          if (blocks[x][y][z].isOpaque()) {
-            break;
-          } else {
-            // Attenuate light in water
-            if (blocks[x][y][z].getType() == WATER) {
-              currentLight -= 2;
-              if (currentLight < 0)
-                currentLight = 0;
-            }
-            blocks[x][y][z].skyLight = currentLight;
-
-            // Queue for spreading if not full brightness?
-            // Actually, if we attenuate, we might want to queue it to
-            // spread the darkness/light? The spreadLight function handles
-            // outward spread. The column is the source. Note: skyQueue is
-            // not accessible here. This line is commented out to maintain
-            // syntactical correctness. if(currentLight > 0) {
-            //     skyQueue.push(glm::ivec3(x, y, z));
-            // }
-          }
-        }
-
-        // If top block was Water, the column below it should also be lit?
-        // The loop goes Y-Down.
-        // Loop continues until isOpaque().
-        // So if top is Water, it is NOT opaque.
-        // blocks[x][y][z].skyLight = 15;
-        // Loop continues.
-        // Next block (below water) is Water. Not Opaque. skyLight = 15.
-        // Next block is Stone. Opaque. Break.
-        // Stone gets 0 (default).
-        // So the water column will be fully lit (15).
-        // However, should water attenuate light? (Darker deeper down).
-        // Minecraft does decrease light by 3 per water block.
-        // For now, full light is fine to fix "Pitch Black".
-      }
     }
   }
 }
@@ -2148,240 +2154,6 @@ void Chunk::calculateBlockLight() {
   }
 }
 
-void Chunk::spreadLight() {
-  std::lock_guard<std::mutex> lock(chunkMutex);
-  std::queue<glm::ivec3> skyQueue;
-  std::queue<glm::ivec3> blockQueue;
-
-  // 1. Seed from self
-  for (int x = 0; x < CHUNK_SIZE; ++x) {
-    for (int y = 0; y < CHUNK_SIZE; ++y) {
-      for (int z = 0; z < CHUNK_SIZE; ++z) {
-        if (blocks[x][y][z].skyLight > 1) {
-          skyQueue.push(glm::ivec3(x, y, z));
-        }
-        if (blocks[x][y][z].blockLight > 1) {
-          blockQueue.push(glm::ivec3(x, y, z));
-        }
-      }
-    }
-  }
-
-  // 2. Seed from Neighbor Chunks
-  // Neighbors: Left(-X), Right(+X), Back(-Z), Front(+Z), Bottom(-Y),
-  // Top(+Y)
-  struct NeighPtr {
-    int ni;
-    int ox, oy, oz;
-    int faceAxis;
-  };
-  NeighPtr nPtrs[] = {
-      {DIR_LEFT, CHUNK_SIZE - 1, 0, 0, 0},
-      {DIR_RIGHT, 0, 0, 0, 0},
-      {DIR_BACK, 0, 0, CHUNK_SIZE - 1,
-       2}, // Back is Z- (Wait, in GreedyMesh faceDir=1 was Z- and
-           // called Back?) Let's standardise: Z- (Back) ->
-           // neighbors[DIR_BACK] Z+ (Front) -> neighbors[DIR_FRONT] X-
-           // (Left) -> neighbors[DIR_LEFT] X+ (Right) ->
-           // neighbors[DIR_RIGHT] Y- (Bottom) -> neighbors[DIR_BOTTOM]
-           // Y+ (Top) -> neighbors[DIR_TOP]
-      {DIR_FRONT, 0, 0, 0, 2},
-      {DIR_BOTTOM, 0, CHUNK_SIZE - 1, 0, 1},
-      {DIR_TOP, 0, 0, 0, 1}};
-  // Note: nPtrs array matches iteration order or just explicit check?
-  // The loop below iterates 'neighbors' array which was struct...
-  // Let's rewrite the loop using explicit neighbors array
-
-  for (const auto &np : nPtrs) {
-    Chunk *nc = neighbors[np.ni];
-    if (nc) {
-      // Iterate face
-      for (int u = 0; u < CHUNK_SIZE; ++u) {
-        for (int v = 0; v < CHUNK_SIZE; ++v) {
-          int lx, ly, lz;
-          int nx, ny, nz;
-
-          // Define iteration based on Face Axis (0=X-face, 1=Y-face,
-          // 2=Z-face) If Axis=0 (Left/Right), u=y, v=z If Axis=1 (Bot/Top),
-          // u=x, v=z If Axis=2 (Back/Front), u=x, v=y
-
-          if (np.faceAxis == 0) { // X neighbors
-            lx = (np.ni == DIR_LEFT) ? 0 : CHUNK_SIZE - 1;
-            ly = u;
-            lz = v;
-            nx = np.ox;
-            ny = u;
-            nz = v;
-          } else if (np.faceAxis == 1) { // Y neighbors
-            lx = u;
-            ly = (np.ni == DIR_BOTTOM) ? 0 : CHUNK_SIZE - 1;
-            lz = v;
-            nx = u;
-            ny = np.oy;
-            nz = v; // np.oy is boundary
-          } else {  // Z neighbors
-            lx = u;
-            ly = v;
-            lz = (np.ni == DIR_BACK) ? 0 : CHUNK_SIZE - 1;
-            nx = u;
-            ny = v;
-            nz = np.oz;
-          }
-
-          if (!blocks[lx][ly][lz].isOpaque()) {
-            // Sky Light
-            uint8_t nSky = nc->getSkyLight(nx, ny, nz);
-            if (nSky > 1 && nSky - 1 > blocks[lx][ly][lz].skyLight) {
-              blocks[lx][ly][lz].skyLight = nSky - 1;
-              skyQueue.push(glm::ivec3(lx, ly, lz));
-              meshDirty = true;
-            }
-            // Block Light
-            uint8_t nBlock = nc->getBlockLight(nx, ny, nz);
-            if (nBlock > 1 && nBlock - 1 > blocks[lx][ly][lz].blockLight) {
-              blocks[lx][ly][lz].blockLight = nBlock - 1;
-              blockQueue.push(glm::ivec3(lx, ly, lz));
-              meshDirty = true;
-            }
-          }
-        }
-      }
-    }
-  }
-
-  if (false) { // Disable old logic
-    if (world) {
-      int cx = chunkPosition.x;
-      int cy = chunkPosition.y;
-      int cz = chunkPosition.z;
-
-      struct Neighbor {
-        int dx, dy, dz;
-        int ox, oy, oz;
-        int faceAxis;
-      };
-      Neighbor neighbors[] = {
-          {-1, 0, 0, CHUNK_SIZE - 1, 0, 0, 0}, {1, 0, 0, 0, 0, 0, 0},
-          {0, -1, 0, 0, CHUNK_SIZE - 1, 0, 1}, {0, 1, 0, 0, 0, 0, 1},
-          {0, 0, -1, 0, 0, CHUNK_SIZE - 1, 2}, {0, 0, 1, 0, 0, 0, 2}};
-
-      for (const auto &n : neighbors) {
-        Chunk *nc = world->getChunk(cx + n.dx, cy + n.dy, cz + n.dz);
-        if (nc) {
-          for (int u = 0; u < CHUNK_SIZE; ++u) {
-            for (int v = 0; v < CHUNK_SIZE; ++v) {
-              int lx, ly, lz;
-              int nx, ny, nz;
-
-              if (n.faceAxis == 0) {
-                lx = (n.dx == -1) ? 0 : CHUNK_SIZE - 1;
-                ly = u;
-                lz = v;
-                nx = n.ox;
-                ny = u;
-                nz = v;
-              } else if (n.faceAxis == 1) {
-                lx = u;
-                ly = (n.dy == -1) ? 0 : CHUNK_SIZE - 1;
-                lz = v;
-                nx = u;
-                ny = n.oy;
-                nz = v;
-              } else {
-                lx = u;
-                ly = v;
-                lz = (n.dz == -1) ? 0 : CHUNK_SIZE - 1;
-                nx = u;
-                ny = v;
-                nz = n.oz;
-              }
-
-              if (!blocks[lx][ly][lz].isActive()) {
-                // Sky Light
-                uint8_t nSky = nc->getSkyLight(nx, ny, nz);
-                if (nSky > 1 && nSky - 1 > blocks[lx][ly][lz].skyLight) {
-                  blocks[lx][ly][lz].skyLight = nSky - 1;
-                  skyQueue.push(glm::ivec3(lx, ly, lz));
-                  meshDirty = true;
-                }
-                // Block Light
-                uint8_t nBlock = nc->getBlockLight(nx, ny, nz);
-                if (nBlock > 1 && nBlock - 1 > blocks[lx][ly][lz].blockLight) {
-                  blocks[lx][ly][lz].blockLight = nBlock - 1;
-                  blockQueue.push(glm::ivec3(lx, ly, lz));
-                  meshDirty = true;
-                }
-              }
-            }
-          }
-        }
-      }
-    }
-  } // End if(false)
-
-  // 3. Propagate BFS
-  int directions[6][3] = {{1, 0, 0},  {-1, 0, 0}, {0, 1, 0},
-                          {0, -1, 0}, {0, 0, 1},  {0, 0, -1}};
-
-  // Process Sky Light
-  while (!skyQueue.empty()) {
-    glm::ivec3 pos = skyQueue.front();
-    skyQueue.pop();
-
-    int curLight = blocks[pos.x][pos.y][pos.z].skyLight;
-    if (curLight <= 1)
-      continue;
-
-    for (int i = 0; i < 6; ++i) {
-      int nx = pos.x + directions[i][0];
-      int ny = pos.y + directions[i][1];
-      int nz = pos.z + directions[i][2];
-
-      if (nx >= 0 && nx < CHUNK_SIZE && ny >= 0 && ny < CHUNK_SIZE && nz >= 0 &&
-          nz < CHUNK_SIZE) {
-        if (!blocks[nx][ny][nz].isOpaque()) {
-          int decay = (blocks[nx][ny][nz].getType() == WATER) ? 3 : 1;
-          if (blocks[nx][ny][nz].skyLight < curLight - decay) {
-            blocks[nx][ny][nz].skyLight = curLight - decay;
-            skyQueue.push(glm::ivec3(nx, ny, nz));
-            meshDirty = true;
-          }
-        }
-      } else {
-        // ... neighbor prop logic ...
-      }
-    }
-  }
-
-  // Process Block Light
-  while (!blockQueue.empty()) {
-    glm::ivec3 pos = blockQueue.front();
-    blockQueue.pop();
-
-    int curLight = blocks[pos.x][pos.y][pos.z].blockLight;
-    if (curLight <= 1)
-      continue;
-
-    for (int i = 0; i < 6; ++i) {
-      int nx = pos.x + directions[i][0];
-      int ny = pos.y + directions[i][1];
-      int nz = pos.z + directions[i][2];
-
-      if (nx >= 0 && nx < CHUNK_SIZE && ny >= 0 && ny < CHUNK_SIZE && nz >= 0 &&
-          nz < CHUNK_SIZE) {
-        if (!blocks[nx][ny][nz].isOpaque()) {
-          int decay = (blocks[nx][ny][nz].getType() == WATER) ? 3 : 1;
-          if (blocks[nx][ny][nz].blockLight < curLight - decay) {
-            blocks[nx][ny][nz].blockLight = curLight - decay;
-            blockQueue.push(glm::ivec3(nx, ny, nz));
-            meshDirty = true;
-          }
-        }
-      }
-    }
-  }
-}
-
 // Helper for Ambient Occlusion
 // side1, side2 are the two blocks next to the vertex on the face plane
 // corner is the block diagonally from the vertex
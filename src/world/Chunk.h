@@ -2,25 +2,35 @@
 #define CHUNK_H
 
 #include <GL/glew.h>
+#include <atomic>
+#include <cstdint>
 #include <glm/glm.hpp>
 #include <mutex>
 #include <vector>
 
-#include "../render/Shader.h"
+#include "../render/ChunkMeshArena.h"
 #include "Block.h"
 
 class World;
+struct ChunkColumn;
 
 const int CHUNK_SIZE = 32;
 
 #include <memory>
 
 class Chunk : public std::enable_shared_from_this<Chunk> {
+  friend class LightEngine;    // Edits light values in place
+  friend class WorldGenerator; // Fills fresh chunks before they are shared
+  friend class ChunkStorage;   // Serializes blocks for saving and loading
+
 public:
   Chunk();
   ~Chunk();
 
   void setWorld(World *w) { world = w; }
+  // Column this chunk was generated from (null for preview/manual chunks)
+  void setColumn(ChunkColumn *c) { column = c; }
+  ChunkColumn *getColumn() const { return column; }
 
   glm::ivec3 chunkPosition; // Chunk coordinates (e.g. 0,0,0)
   // Thread Safety
@@ -37,9 +47,13 @@ public:
   // Helper for Sync update (Generate + Upload)
   void updateMesh();
 
-  bool meshDirty; // Flag for light updates
-  bool needsLightingUpdate =
-      false; // Flag to recalculate lighting before mesh gen
+  // Changed since a mesh was last requested. Cleared by QueueMeshUpdate;
+  // render() only requeues chunks changed outside the World edit paths.
+  std::atomic<bool> meshDirty;
+  // Edited since it was last written to the world's save directory
+  std::atomic<bool> unsaved{false};
+  // Has a copy in the save directory (loaded from it or written to it)
+  bool stored = false;
 
   // Neighbor Pointers (Cached for lock-free access)
   // Indexes: 0=Front(Z+), 1=Back(Z-), 2=Left(X-), 3=Right(X+), 4=Top(Y+),
@@ -52,12 +66,34 @@ public:
   static const int DIR_TOP = 4;
   static const int DIR_BOTTOM = 5;
 
-  void calculateSunlight(); // Step 1: Seed Skylight
+  // Cave culling: true if a ray entering through face 'fromFace' can leave
+  // through face 'toFace' via connected non-opaque voxels (DIR_* indices).
+  // Until the first mesh is built every face pair is considered connected.
+  bool canSeeThrough(int fromFace, int toFace) const {
+    return (visibilityMask.load(std::memory_order_relaxed) >>
+            (fromFace * 6 + toFace)) &
+           1ULL;
+  }
+
+  // Occlusion culling: number of fully opaque layers at the bottom of each
+  // OCCLUDER_TILE x OCCLUDER_TILE footprint tile, from the last mesh build.
+  static const int OCCLUDER_TILE = 8;
+  static const int OCCLUDER_TILES = CHUNK_SIZE / OCCLUDER_TILE; // Per axis
+  int getOccluderHeight(int tx, int tz) const {
+    int t = tx + tz * OCCLUDER_TILES;
+    return (occluderHeights[t >> 3].load(std::memory_order_relaxed) >>
+            ((t & 7) * 8)) &
+           0xFF;
+  }
+
+  // Raise the column's sky height to this chunk's highest opaque voxels
+  void raiseSkyHeights();
+  // Reset block light and seed emitters; LightEngine spreads it
   void calculateBlockLight();
-  void spreadLight(); // Step 2: Spread light
-  void render(Shader &shader, const glm::mat4 &viewProjection,
-              int pass); // 0=Opaque, 1=Transparent
-  void initGL();
+  // Set by LightEngine once this chunk's whole column has been lit
+  bool isLightReady() const { return lightReady.load(); }
+  // Appends this chunk's arena range for a pass (0=Opaque, 1=Transparent)
+  void appendDraw(std::vector<ChunkDraw> &draws, int pass) const;
 
   ChunkBlock getBlock(int x, int y, int z) const;
   void setBlock(int x, int y, int z, BlockType type);
@@ -78,14 +114,31 @@ public:
 private:
   ChunkBlock blocks[CHUNK_SIZE][CHUNK_SIZE][CHUNK_SIZE];
   World *world;
-  unsigned int VAO, VBO, EBO;
+  ChunkColumn *column = nullptr;
+  // GPU mesh lives in the world's arena; keep it alive to free our range
+  std::shared_ptr<ChunkMeshArena> meshArena;
+  ArenaAllocation meshAlloc;
   int vertexCount;
   int vertexCountTransparent;
   std::vector<float> transparentVertices; // CPU-side copy for sorting
   glm::vec3 m_lastSortCameraPos = glm::vec3(-99999.0f); // Initialize far away
 
+  // 6x6 face connectivity bitset, bit (a * 6 + b). Written by mesh workers,
+  // read by World::render.
+  static const uint64_t ALL_FACES_VISIBLE = (1ULL << 36) - 1;
+  std::atomic<uint64_t> visibilityMask{ALL_FACES_VISIBLE};
+  // One byte per occluder tile, 8 tiles per word
+  std::atomic<uint64_t> occluderHeights[2];
+  std::atomic<bool> lightReady{false};
+
 public:
   void sortAndUploadTransparent(const glm::vec3 &cameraPos);
+  // Back-to-front copy of whole transparent faces (as built by
+  // generateGeometry) of a chunk at world position 'origin'
+  static void sortTransparentFaces(const std::vector<float> &vertices,
+                                   const glm::vec3 &origin,
+                                   const glm::vec3 &cameraPos,
+                                   std::vector<float> &sorted);
 
 private:
   void addFace(std::vector<float> &vertices, int x, int y, int z, int faceDir,
@@ -93,6 +146,8 @@ private:
                int aoTR, int aoTL, uint8_t metadata, float hBL, float hBR,
                float hTR, float hTL, int layer = 0);
   int vertexAO(bool side1, bool side2, bool corner);
+  void computeVisibility(); // Caller must hold chunkMutex
+  void computeOccluders();  // Caller must hold chunkMutex
 };
 
 #endif
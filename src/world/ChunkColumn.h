@@ -1,17 +1,58 @@
 #ifndef CHUNK_COLUMN_H
 #define CHUNK_COLUMN_H
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
 #include "Chunk.h"          // For CHUNK_SIZE
 #include "WorldGenerator.h" // For Biome enum
 
+// Decoration placed once per column by WorldDecorator::PlanStructures and
+// stamped by the decorators into every chunk its bounds intersect
+enum StructureType : uint8_t {
+  STRUCTURE_OAK,
+  STRUCTURE_PINE,
+  STRUCTURE_CACTUS,
+  STRUCTURE_PLANT
+};
+
+struct ColumnStructure {
+  StructureType type;
+  BlockType block = AIR; // STRUCTURE_PLANT only
+  int size = 0;          // Trunk / stem height
+  glm::ivec3 root;       // Ground block it stands on (world coordinates)
+  glm::ivec3 min, max;   // Inclusive world-space bounds
+};
+
 struct ChunkColumn {
   int heightMap[CHUNK_SIZE][CHUNK_SIZE];
   Biome biomeMap[CHUNK_SIZE][CHUNK_SIZE];
   float temperatureMap[CHUNK_SIZE][CHUNK_SIZE];
   float humidityMap[CHUNK_SIZE][CHUNK_SIZE];
   float beachNoiseMap[CHUNK_SIZE][CHUNK_SIZE];
-  float strataWaveMap[CHUNK_SIZE][CHUNK_SIZE];
-  float strataTypeMap[CHUNK_SIZE][CHUNK_SIZE];
+  // Strata layout, derived once from the strata noise grids: band
+  // boundaries are shifted by strataShift, and the deep and mid variant
+  // bands use the BlockTypes strataDeep / strataMid
+  int8_t strataShift[CHUNK_SIZE][CHUNK_SIZE];
+  uint8_t strataDeep[CHUNK_SIZE][CHUNK_SIZE];
+  uint8_t strataMid[CHUNK_SIZE][CHUNK_SIZE];
+
+  // Highest opaque block Y per column. Starts at the terrain height, is
+  // raised as the column's chunks generate and is kept current by
+  // World::setBlock. Atomic so lighting can read it without columnMutex.
+  std::atomic<int> skyHeight[CHUNK_SIZE][CHUNK_SIZE];
+
+  // Chunks of this column currently linked into the world. Guarded by the
+  // LightEngine mutex; the column is lit once all of them are present.
+  int linkedChunks = 0;
+
+  // Every structure touching this column, including ones rooted in
+  // neighbouring columns that overhang it. Planned by the first chunk of the
+  // column to be decorated; read-only afterwards.
+  mutable std::vector<ColumnStructure> structures;
+  mutable std::once_flag structuresOnce;
 
   // Accessors if we want them, or direct access since it's a struct
   int getHeight(int localX, int localZ) const {
@@ -21,6 +62,23 @@ struct ChunkColumn {
   Biome getBiome(int localX, int localZ) const {
     return biomeMap[localX][localZ];
   }
+
+  int getSkyHeight(int localX, int localZ) const {
+    return skyHeight[localX][localZ].load(std::memory_order_relaxed);
+  }
+
+  void setSkyHeight(int localX, int localZ, int y) {
+    skyHeight[localX][localZ].store(y, std::memory_order_relaxed);
+  }
+
+  // Never lowers, so chunks of one column can generate concurrently
+  void raiseSkyHeight(int localX, int localZ, int y) {
+    std::atomic<int> &h = skyHeight[localX][localZ];
+    int cur = h.load(std::memory_order_relaxed);
+    while (y > cur &&
+           !h.compare_exchange_weak(cur, y, std::memory_order_relaxed)) {
+    }
+  }
 };
 
 #endif
@@ -0,0 +1,451 @@
+#include "ChunkStorage.h"
+#include "../debug/Logger.h"
+#include "Block.h"
+#include "Chunk.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+
+namespace {
+
+inline int floorDiv(int a, int b) {
+  return (a >= 0) ? a / b : (a - b + 1) / b;
+}
+
+// Region files are little-endian regardless of the host
+void put32(uint8_t *p, uint32_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+}
+
+uint32_t get32(const uint8_t *p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+         ((uint32_t)p[3] << 24);
+}
+
+} // namespace
+
+// --- RegionFile ---
+
+RegionFile::RegionFile(const std::string &path, bool create)
+    : table(ENTRIES) {
+  file.open(path, std::ios::in | std::ios::out | std::ios::binary);
+  if (file.is_open()) {
+    // Never overwrite a file we can't parse; its chunks just regenerate
+    if (!readHeader()) {
+      LOG_WORLD_ERROR("Region file {} is corrupt; ignoring it", path);
+      file.close();
+    }
+    return;
+  }
+  if (!create)
+    return;
+
+  file.clear();
+  file.open(path, std::ios::in | std::ios::out | std::ios::binary |
+                      std::ios::trunc);
+  if (!file.is_open()) {
+    LOG_WORLD_ERROR("Could not create region file {}", path);
+    return;
+  }
+  writeHeader();
+  usedSectors.assign(HEADER_SECTORS, true);
+}
+
+bool RegionFile::readHeader() {
+  std::vector<uint8_t> header((size_t)HEADER_SECTORS * SECTOR_SIZE);
+  file.seekg(0);
+  if (!file.read((char *)header.data(), header.size()))
+    return false;
+  if (get32(&header[0]) != MAGIC || get32(&header[4]) != VERSION)
+    return false;
+
+  file.seekg(0, std::ios::end);
+  uint32_t fileSectors =
+      (uint32_t)(((uint64_t)file.tellg() + SECTOR_SIZE - 1) / SECTOR_SIZE);
+  usedSectors.assign(std::max(fileSectors, (uint32_t)HEADER_SECTORS), false);
+  setUsed(0, HEADER_SECTORS, true);
+
+  // Rebuild the free map; drop entries pointing outside the file
+  for (int i = 0; i < ENTRIES; ++i) {
+    const uint8_t *p = &header[TABLE_OFFSET + i * 8];
+    Entry e;
+    e.sector = get32(p);
+    e.length = get32(p + 4);
+    if (e.sector == 0)
+      continue;
+    uint32_t count = sectorsFor(e.length);
+    if (e.length == 0 || e.sector < (uint32_t)HEADER_SECTORS ||
+        (uint64_t)e.sector + count > usedSectors.size())
+      continue;
+    table[i] = e;
+    setUsed(e.sector, count, true);
+  }
+  return true;
+}
+
+void RegionFile::writeHeader() {
+  std::vector<uint8_t> header((size_t)HEADER_SECTORS * SECTOR_SIZE, 0);
+  put32(&header[0], MAGIC);
+  put32(&header[4], VERSION);
+  file.seekp(0);
+  file.write((const char *)header.data(), header.size());
+  file.flush();
+}
+
+void RegionFile::writeEntry(int i) {
+  uint8_t bytes[8];
+  put32(bytes, table[i].sector);
+  put32(bytes + 4, table[i].length);
+  file.seekp(TABLE_OFFSET + (std::streamoff)i * 8);
+  file.write((const char *)bytes, sizeof(bytes));
+  file.flush();
+}
+
+uint32_t RegionFile::allocate(uint32_t count) {
+  // First fit among the free sectors
+  uint32_t run = 0;
+  for (uint32_t s = HEADER_SECTORS; s < usedSectors.size(); ++s) {
+    run = usedSectors[s] ? 0 : run + 1;
+    if (run == count)
+      return s + 1 - count;
+  }
+  // Append, reusing a free run at the end of the file
+  return (uint32_t)usedSectors.size() - run;
+}
+
+void RegionFile::setUsed(uint32_t first, uint32_t count, bool used) {
+  if (first + count > usedSectors.size())
+    usedSectors.resize(first + count, false);
+  for (uint32_t s = first; s < first + count; ++s)
+    usedSectors[s] = used;
+}
+
+bool RegionFile::read(int lx, int ly, int lz, std::vector<uint8_t> &out) {
+  const Entry &e = table[index(lx, ly, lz)];
+  if (e.sector == 0)
+    return false;
+
+  out.resize(e.length);
+  file.seekg((std::streamoff)e.sector * SECTOR_SIZE);
+  if (!file.read((char *)out.data(), e.length)) {
+    file.clear();
+    out.clear();
+    return false;
+  }
+  return true;
+}
+
+bool RegionFile::write(int lx, int ly, int lz,
+                       const std::vector<uint8_t> &data) {
+  if (!isOpen() || data.empty())
+    return false;
+
+  int i = index(lx, ly, lz);
+  Entry old = table[i];
+  uint32_t oldCount = old.sector ? sectorsFor(old.length) : 0;
+  uint32_t count = sectorsFor((uint32_t)data.size());
+
+  // Never overwrite the live copy: the old run stays reserved until the
+  // table points at the new one
+  uint32_t first = allocate(count);
+  setUsed(first, count, true);
+
+  // Pad to whole sectors so the file always ends on a sector boundary
+  std::vector<char> padding((size_t)count * SECTOR_SIZE - data.size(), 0);
+  file.seekp((std::streamoff)first * SECTOR_SIZE);
+  file.write((const char *)data.data(), data.size());
+  file.write(padding.data(), padding.size());
+  file.flush();
+  if (!file) {
+    file.clear();
+    setUsed(first, count, false);
+    return false;
+  }
+
+  table[i].sector = first;
+  table[i].length = (uint32_t)data.size();
+  writeEntry(i);
+
+  if (old.sector != 0)
+    setUsed(old.sector, oldCount, false);
+  return true;
+}
+
+// --- ChunkStorage ---
+
+ChunkStorage::ChunkStorage(const std::string &directory)
+    : directory(directory) {
+  std::error_code ec;
+  std::filesystem::create_directories(directory, ec);
+  if (ec)
+    LOG_WORLD_ERROR("Could not create save directory {}: {}", directory,
+                    ec.message());
+  else
+    LOG_WORLD_INFO("Saving chunks to {}", directory);
+
+  indexRegions();
+  thread = std::thread(&ChunkStorage::ioLoop, this);
+}
+
+void ChunkStorage::indexRegions() {
+  // Runs before the I/O thread starts, so the files are read directly
+  std::error_code ec;
+  for (const std::filesystem::directory_entry &entry :
+       std::filesystem::directory_iterator(directory, ec)) {
+    int rx, rz;
+    std::string name = entry.path().filename().string();
+    if (entry.path().extension() != ".lrg" ||
+        sscanf(name.c_str(), "r.%d.%d", &rx, &rz) != 2)
+      continue;
+
+    RegionFile region(entry.path().string(), false);
+    if (!region.isOpen())
+      continue;
+    for (int ly = 0; ly < RegionFile::HEIGHT; ++ly)
+      for (int lz = 0; lz < RegionFile::SIZE; ++lz)
+        for (int lx = 0; lx < RegionFile::SIZE; ++lx)
+          if (region.contains(lx, ly, lz))
+            stored.emplace(rx * RegionFile::SIZE + lx, ly,
+                           rz * RegionFile::SIZE + lz);
+  }
+  LOG_WORLD_INFO("{} saved chunks", stored.size());
+}
+
+ChunkStorage::~ChunkStorage() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    shutdown = true;
+  }
+  condition.notify_all();
+  if (thread.joinable())
+    thread.join();
+}
+
+bool ChunkStorage::loadChunk(Chunk &chunk) {
+  glm::ivec3 pos = chunk.chunkPosition;
+  if (pos.y < 0 || pos.y >= RegionFile::HEIGHT)
+    return false;
+
+  Request request;
+  request.x = pos.x;
+  request.y = pos.y;
+  request.z = pos.z;
+  request.result = std::make_shared<std::promise<std::vector<uint8_t>>>();
+  std::future<std::vector<uint8_t>> future = request.result->get_future();
+  std::shared_ptr<const std::vector<uint16_t>> pending;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    // A save still queued (or being written) is newer than the disk copy
+    auto key = std::make_tuple(pos.x, pos.y, pos.z);
+    auto it = pendingSaves.find(key);
+    if (it != pendingSaves.end())
+      pending = it->second;
+    else if (!stored.count(key))
+      return false;
+    else
+      loads.push_back(std::move(request));
+  }
+  if (pending) {
+    fillChunk(chunk, *pending);
+    return true;
+  }
+  condition.notify_one();
+
+  std::vector<uint8_t> data = future.get();
+  if (data.empty())
+    return false;
+
+  std::vector<uint16_t> voxels;
+  if (!decode(data, voxels)) {
+    LOG_WORLD_WARN("Saved chunk ({}, {}, {}) is corrupt; regenerating",
+                   pos.x, pos.y, pos.z);
+    return false;
+  }
+  fillChunk(chunk, voxels);
+  return true;
+}
+
+void ChunkStorage::fillChunk(Chunk &chunk,
+                             const std::vector<uint16_t> &voxels) {
+  BlockRegistry &registry = BlockRegistry::getInstance();
+  const uint16_t *v = voxels.data();
+  for (int y = 0; y < CHUNK_SIZE; ++y)
+    for (int x = 0; x < CHUNK_SIZE; ++x)
+      for (int z = 0; z < CHUNK_SIZE; ++z, ++v) {
+        ChunkBlock &b = chunk.blocks[x][y][z];
+        b.block = registry.getBlock((uint8_t)(*v & 0xFF));
+        b.metadata = (uint8_t)(*v >> 8);
+      }
+}
+
+void ChunkStorage::saveChunk(const Chunk &chunk) {
+  glm::ivec3 pos = chunk.chunkPosition;
+  if (pos.y < 0 || pos.y >= RegionFile::HEIGHT) {
+    LOG_WORLD_ERROR("Chunk ({}, {}, {}) is outside the region height; "
+                    "its edits are not saved",
+                    pos.x, pos.y, pos.z);
+    return;
+  }
+
+  auto voxels = std::make_shared<std::vector<uint16_t>>((size_t)VOXELS);
+  uint16_t *v = voxels->data();
+  for (int y = 0; y < CHUNK_SIZE; ++y)
+    for (int x = 0; x < CHUNK_SIZE; ++x)
+      for (int z = 0; z < CHUNK_SIZE; ++z, ++v) {
+        const ChunkBlock &b = chunk.blocks[x][y][z];
+        *v = (uint16_t)(b.getType() | (b.metadata << 8));
+      }
+
+  Request request;
+  request.x = pos.x;
+  request.y = pos.y;
+  request.z = pos.z;
+  request.voxels = voxels;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto key = std::make_tuple(pos.x, pos.y, pos.z);
+    pendingSaves[key] = voxels;
+    stored.insert(key);
+    saves.push_back(std::move(request));
+  }
+  condition.notify_one();
+}
+
+void ChunkStorage::flush() {
+  std::unique_lock<std::mutex> lock(mutex);
+  idleCondition.wait(
+      lock, [this] { return loads.empty() && saves.empty() && !busy; });
+}
+
+void ChunkStorage::ioLoop() {
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    condition.wait(lock, [this] {
+      return !loads.empty() || !saves.empty() || shutdown;
+    });
+    if (loads.empty() && saves.empty())
+      break; // Shutting down with nothing left to write
+
+    // Generation workers block on loads, so they skip the save backlog
+    std::deque<Request> &queue = loads.empty() ? saves : loads;
+    Request request = std::move(queue.front());
+    queue.pop_front();
+    busy = true;
+    lock.unlock();
+
+    serve(request);
+
+    lock.lock();
+    busy = false;
+    if (request.voxels) {
+      // Written; unless a newer snapshot replaced it, the disk copy is
+      // current again
+      auto it = pendingSaves.find(
+          std::make_tuple(request.x, request.y, request.z));
+      if (it != pendingSaves.end() && it->second == request.voxels)
+        pendingSaves.erase(it);
+    }
+    if (loads.empty() && saves.empty())
+      idleCondition.notify_all();
+  }
+}
+
+void ChunkStorage::serve(Request &request) {
+  int rx = floorDiv(request.x, RegionFile::SIZE);
+  int rz = floorDiv(request.z, RegionFile::SIZE);
+  int lx = request.x - rx * RegionFile::SIZE;
+  int lz = request.z - rz * RegionFile::SIZE;
+
+  if (request.result) {
+    std::vector<uint8_t> data;
+    RegionFile *region = getRegion(rx, rz, false);
+    if (region)
+      region->read(lx, request.y, lz, data);
+    request.result->set_value(std::move(data));
+    return;
+  }
+
+  encode(*request.voxels, scratch);
+  RegionFile *region = getRegion(rx, rz, true);
+  if (!region || !region->write(lx, request.y, lz, scratch))
+    LOG_WORLD_ERROR("Failed to save chunk ({}, {}, {})", request.x,
+                    request.y, request.z);
+}
+
+RegionFile *ChunkStorage::getRegion(int rx, int rz, bool create) {
+  std::pair<int, int> key(rx, rz);
+  auto it = regions.find(key);
+  if (it != regions.end() && (it->second || !create))
+    return it->second.get();
+
+  // Closing everything is rare and regions reopen on demand
+  if (regions.size() >= MAX_OPEN_REGIONS)
+    regions.clear();
+
+  std::string path = directory + "/r." + std::to_string(rx) + "." +
+                     std::to_string(rz) + ".lrg";
+  auto region = std::make_unique<RegionFile>(path, create);
+  if (!region->isOpen())
+    region.reset();
+  RegionFile *result = region.get();
+  regions[key] = std::move(region);
+  return result;
+}
+
+// Chunk payload: a format byte, then runs over the voxels in y-major order
+// (whole horizontal layers, which terrain strata keep uniform). Each run is
+// a LEB128 length followed by the 16-bit voxel (type | metadata << 8).
+void ChunkStorage::encode(const std::vector<uint16_t> &voxels,
+                          std::vector<uint8_t> &out) {
+  out.clear();
+  out.push_back((uint8_t)FORMAT_VERSION);
+
+  size_t i = 0;
+  while (i < voxels.size()) {
+    uint16_t value = voxels[i];
+    size_t run = 1;
+    while (i + run < voxels.size() && voxels[i + run] == value)
+      ++run;
+    i += run;
+
+    while (run >= 0x80) {
+      out.push_back((uint8_t)(run | 0x80));
+      run >>= 7;
+    }
+    out.push_back((uint8_t)run);
+    out.push_back((uint8_t)(value & 0xFF));
+    out.push_back((uint8_t)(value >> 8));
+  }
+}
+
+bool ChunkStorage::decode(const std::vector<uint8_t> &data,
+                          std::vector<uint16_t> &voxels) {
+  if (data.empty() || data[0] != FORMAT_VERSION)
+    return false;
+
+  voxels.clear();
+  voxels.reserve(VOXELS);
+  size_t p = 1;
+  while (p < data.size()) {
+    size_t run = 0;
+    int shift = 0;
+    uint8_t byte;
+    do {
+      if (p >= data.size() || shift > 14)
+        return false;
+      byte = data[p++];
+      run |= (size_t)(byte & 0x7F) << shift;
+      shift += 7;
+    } while (byte & 0x80);
+
+    if (run == 0 || p + 2 > data.size() || voxels.size() + run > VOXELS)
+      return false;
+    uint16_t value = (uint16_t)(data[p] | (data[p + 1] << 8));
+    p += 2;
+    voxels.insert(voxels.end(), run, value);
+  }
+  return voxels.size() == VOXELS;
+}
@@ -0,0 +1,148 @@
+#ifndef CHUNK_STORAGE_H
+#define CHUNK_STORAGE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+class Chunk;
+
+// One region file: 32x32 chunk columns, 32 chunks tall.
+// A header table maps every chunk slot to a run of 4 KiB sectors and the
+// byte length stored there. Every write goes to a run taken first-fit from
+// the free sectors, and the old run is released only once the table entry
+// points at the new one, so an interrupted write leaves the previous copy
+// intact. The free map is rebuilt from the table on open. Not thread-safe; owned by the
+// ChunkStorage I/O thread.
+class RegionFile {
+public:
+  static const int SIZE = 32;   // Chunk columns per side
+  // Chunks per column, enough for the tallest world the menu allows
+  // (1024 blocks)
+  static const int HEIGHT = 32;
+  static const int SECTOR_SIZE = 4096;
+
+  // Opens 'path'; a missing file is created only if 'create' is set
+  RegionFile(const std::string &path, bool create);
+
+  bool isOpen() const { return file.is_open(); }
+  bool contains(int lx, int ly, int lz) const {
+    return table[index(lx, ly, lz)].sector != 0;
+  }
+  // Stored bytes of chunk slot (lx, ly, lz); false if it was never written
+  bool read(int lx, int ly, int lz, std::vector<uint8_t> &out);
+  bool write(int lx, int ly, int lz, const std::vector<uint8_t> &data);
+
+private:
+  static const uint32_t MAGIC = 0x4E47524C; // "LRGN"
+  static const uint32_t VERSION = 2;
+  static const int ENTRIES = SIZE * SIZE * HEIGHT;
+  static const int TABLE_OFFSET = 16; // After magic and version
+  static const int HEADER_SECTORS =
+      (TABLE_OFFSET + ENTRIES * 8 + SECTOR_SIZE - 1) / SECTOR_SIZE;
+
+  struct Entry {
+    uint32_t sector = 0; // 0 = not stored
+    uint32_t length = 0; // Bytes
+  };
+
+  static int index(int lx, int ly, int lz) {
+    return (ly * SIZE + lz) * SIZE + lx;
+  }
+  static uint32_t sectorsFor(uint32_t length) {
+    return (length + SECTOR_SIZE - 1) / SECTOR_SIZE;
+  }
+  bool readHeader();
+  void writeHeader();
+  void writeEntry(int i);
+  uint32_t allocate(uint32_t count);
+  void setUsed(uint32_t first, uint32_t count, bool used);
+
+  std::fstream file;
+  std::vector<Entry> table;
+  std::vector<bool> usedSectors;
+};
+
+// Asynchronous chunk persistence for one world directory.
+// A dedicated I/O thread serves loads ahead of any queued saves, so
+// generation never waits behind an autosave. Saves snapshot the block ids
+// and metadata on the calling thread and are compressed and written on the
+// I/O thread; until a snapshot is on disk, loads of that chunk are served
+// from it directly. The stored chunks are indexed when the storage is
+// opened, so loads of anything else return without touching the I/O
+// thread. Light is not stored; it is recomputed when the chunk is linked.
+class ChunkStorage {
+public:
+  explicit ChunkStorage(const std::string &directory);
+  ~ChunkStorage(); // Writes everything still queued
+
+  // Fill 'chunk' (positioned, freshly constructed) from its latest save.
+  // Blocks the calling worker until the I/O thread has read it, unless the
+  // save is still waiting to be written. False (at once if the chunk was
+  // never saved) when there is nothing to decode; it must be generated.
+  bool loadChunk(Chunk &chunk);
+  // Queue a write of the chunk's current contents
+  void saveChunk(const Chunk &chunk);
+  // Wait until every queued request has been served
+  void flush();
+
+private:
+  static const int VOXELS = 32 * 32 * 32;
+  static const uint8_t FORMAT_VERSION = 1;
+  // Open region files kept around by the I/O thread
+  static const size_t MAX_OPEN_REGIONS = 64;
+
+  struct Request {
+    int x, y, z; // Chunk coordinates
+    // Saves: type | metadata << 8, shared with pendingSaves
+    std::shared_ptr<const std::vector<uint16_t>> voxels;
+    // Loads: receives the stored bytes, empty if there are none
+    std::shared_ptr<std::promise<std::vector<uint8_t>>> result;
+  };
+
+  void indexRegions();
+  void ioLoop();
+  void serve(Request &request);
+  RegionFile *getRegion(int rx, int rz, bool create);
+  static void fillChunk(Chunk &chunk, const std::vector<uint16_t> &voxels);
+
+  // Run-length encoding of the voxel stream (see ChunkStorage.cpp)
+  static void encode(const std::vector<uint16_t> &voxels,
+                     std::vector<uint8_t> &out);
+  static bool decode(const std::vector<uint8_t> &data,
+                     std::vector<uint16_t> &voxels);
+
+  std::string directory;
+
+  std::mutex mutex;
+  std::condition_variable condition;     // Work queued or shutdown
+  std::condition_variable idleCondition; // Queue drained
+  std::deque<Request> loads; // Served first
+  std::deque<Request> saves;
+  // Latest snapshot of every chunk with a save queued or being written
+  std::map<std::tuple<int, int, int>,
+           std::shared_ptr<const std::vector<uint16_t>>>
+      pendingSaves;
+  // Every chunk with a copy on disk or a save queued
+  std::set<std::tuple<int, int, int>> stored;
+  bool busy = false; // Guarded by mutex; a request is being served
+  bool shutdown = false;
+  std::thread thread;
+
+  // I/O thread only. Null entries remember regions with no file yet.
+  std::map<std::pair<int, int>, std::unique_ptr<RegionFile>> regions;
+  std::vector<uint8_t> scratch;
+};
+
+#endif
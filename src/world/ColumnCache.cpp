@@ -0,0 +1,295 @@
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "ColumnCache.h"
+#include "../debug/Logger.h"
+#include "ChunkColumn.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+struct ColumnCache::Header {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t recordSize; // Catches layout changes (e.g. CHUNK_SIZE)
+  uint32_t generatorVersion;
+  uint64_t configHash;
+};
+
+struct ColumnCache::Record {
+  int32_t cx, cz; // Must stay first; indexed on open
+  int32_t height[CHUNK_SIZE][CHUNK_SIZE];
+  float temperature[CHUNK_SIZE][CHUNK_SIZE];
+  float humidity[CHUNK_SIZE][CHUNK_SIZE];
+  float beachNoise[CHUNK_SIZE][CHUNK_SIZE];
+  uint8_t biome[CHUNK_SIZE][CHUNK_SIZE];
+  int8_t strataShift[CHUNK_SIZE][CHUNK_SIZE];
+  uint8_t strataDeep[CHUNK_SIZE][CHUNK_SIZE];
+  uint8_t strataMid[CHUNK_SIZE][CHUNK_SIZE];
+};
+
+static const uint32_t CACHE_MAGIC = 0x4C4F434C; // "LCOL"
+static const uint32_t CACHE_VERSION = 2;
+
+std::shared_ptr<ColumnCache> ColumnCache::Open(const std::string &directory,
+                                               const WorldGenConfig &config) {
+  uint64_t configHash = HashWorldGenConfig(config);
+  char name[48];
+  snprintf(name, sizeof(name), "columns_%016llx.bin",
+           (unsigned long long)configHash);
+  std::string path = directory + "/" + name;
+
+  // Two instances appending to one file would corrupt it
+  static std::mutex s_Mutex;
+  static std::map<std::string, std::weak_ptr<ColumnCache>> s_Open;
+  std::lock_guard<std::mutex> lock(s_Mutex);
+  if (auto cache = s_Open[path].lock())
+    return cache;
+
+  std::error_code ec;
+  std::filesystem::create_directories(directory, ec);
+  Prune(directory, path, s_Open);
+  std::shared_ptr<ColumnCache> cache(new ColumnCache());
+  if (!cache->OpenFile(path, configHash)) {
+    LOG_WORLD_ERROR("Could not open column cache {}", path);
+    return nullptr;
+  }
+  // Opening counts as a use for pruning
+  std::filesystem::last_write_time(
+      path, std::filesystem::file_time_type::clock::now(), ec);
+  s_Open[path] = cache;
+  LOG_WORLD_INFO("Column cache {}: {} columns", path, cache->m_Index.size());
+  return cache;
+}
+
+void ColumnCache::Prune(
+    const std::string &directory, const std::string &keep,
+    const std::map<std::string, std::weak_ptr<ColumnCache>> &open) {
+  namespace fs = std::filesystem;
+  struct CacheFile {
+    fs::path path;
+    fs::file_time_type time;
+    uint64_t size;
+  };
+  std::vector<CacheFile> files;
+  uint64_t total = 0;
+  std::error_code ec;
+  for (const fs::directory_entry &entry :
+       fs::directory_iterator(directory, ec)) {
+    std::string name = entry.path().filename().string();
+    if (name.rfind("columns_", 0) != 0 || entry.path().extension() != ".bin")
+      continue;
+    CacheFile file{entry.path(), entry.last_write_time(ec),
+                   (uint64_t)entry.file_size(ec)};
+    total += file.size;
+    std::string path = directory + "/" + name;
+    auto it = open.find(path);
+    bool inUse = path == keep || (it != open.end() && !it->second.expired());
+    if (!inUse)
+      files.push_back(file);
+  }
+
+  // Least recently opened first
+  std::sort(files.begin(), files.end(),
+            [](const CacheFile &a, const CacheFile &b) {
+              return a.time < b.time;
+            });
+  for (const CacheFile &file : files) {
+    if (total <= MAX_TOTAL_BYTES)
+      break;
+    if (fs::remove(file.path, ec)) {
+      total -= file.size;
+      LOG_WORLD_INFO("Pruned column cache {}", file.path.string());
+    }
+  }
+}
+
+ColumnCache::~ColumnCache() {
+  if (!m_Mapped)
+    return;
+#ifdef _WIN32
+  UnmapViewOfFile(m_Mapped);
+#else
+  munmap((void *)m_Mapped, m_MappedSize);
+#endif
+}
+
+bool ColumnCache::OpenFile(const std::string &path, uint64_t configHash) {
+  bool valid = false;
+  {
+    std::ifstream in(path, std::ios::binary);
+    Header header;
+    valid = in.read((char *)&header, sizeof(header)) &&
+            header.magic == CACHE_MAGIC && header.version == CACHE_VERSION &&
+            header.recordSize == sizeof(Record) &&
+            header.generatorVersion == WorldGenerator::GENERATOR_VERSION &&
+            header.configHash == configHash;
+  }
+  if (!valid) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    Header header = {CACHE_MAGIC, CACHE_VERSION, (uint32_t)sizeof(Record),
+                     WorldGenerator::GENERATOR_VERSION, configHash};
+    out.write((const char *)&header, sizeof(header));
+    if (!out)
+      return false;
+  }
+
+  // Whole records only: a torn append from an interrupted run is dropped
+  std::error_code ec;
+  uint64_t size = std::filesystem::file_size(path, ec);
+  if (ec)
+    return false;
+  uint64_t count = (size - sizeof(Header)) / sizeof(Record);
+  m_FileSize = sizeof(Header) + count * sizeof(Record);
+  if (m_FileSize != size)
+    std::filesystem::resize_file(path, m_FileSize, ec);
+
+  m_File.open(path, std::ios::in | std::ios::out | std::ios::binary);
+  if (!m_File.is_open())
+    return false;
+  if (count > 0)
+    MapFile(path);
+
+  for (uint64_t i = 0; i < count; ++i) {
+    uint64_t offset = sizeof(Header) + i * sizeof(Record);
+    int32_t key[2];
+    if (offset + sizeof(Record) <= m_MappedSize) {
+      memcpy(key, m_Mapped + offset, sizeof(key));
+    } else {
+      m_File.seekg((std::streamoff)offset);
+      if (!m_File.read((char *)key, sizeof(key))) {
+        m_File.clear();
+        continue;
+      }
+    }
+    m_Index[Key(key[0], key[1])] = offset;
+  }
+  return true;
+}
+
+void ColumnCache::MapFile(const std::string &path) {
+  // Without a mapping, every read just goes through m_File
+#ifdef _WIN32
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ,
+                            FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return;
+  HANDLE mapping =
+      CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping) {
+    // The view keeps the file open after both handles are closed
+    void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view) {
+      m_Mapped = (const uint8_t *)view;
+      m_MappedSize = m_FileSize;
+    }
+    CloseHandle(mapping);
+  }
+  CloseHandle(file);
+#else
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return;
+  void *view = mmap(nullptr, m_FileSize, PROT_READ, MAP_SHARED, fd, 0);
+  if (view != MAP_FAILED) {
+    m_Mapped = (const uint8_t *)view;
+    m_MappedSize = m_FileSize;
+  }
+  close(fd);
+#endif
+}
+
+bool ColumnCache::ReadRecord(uint64_t offset, Record &record) {
+  m_File.seekg((std::streamoff)offset);
+  if (!m_File.read((char *)&record, sizeof(Record))) {
+    m_File.clear();
+    return false;
+  }
+  return true;
+}
+
+bool ColumnCache::Load(int cx, int cz, ChunkColumn &column) {
+  const Record *r = nullptr;
+  std::unique_ptr<Record> tail;
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto it = m_Index.find(Key(cx, cz));
+    if (it == m_Index.end())
+      return false;
+    if (it->second + sizeof(Record) <= m_MappedSize) {
+      // The mapping is immutable; copy from it outside the lock
+      r = (const Record *)(m_Mapped + it->second);
+    } else {
+      tail = std::make_unique<Record>();
+      if (!ReadRecord(it->second, *tail))
+        return false;
+      r = tail.get();
+    }
+  }
+
+  memcpy(column.heightMap, r->height, sizeof(r->height));
+  memcpy(column.temperatureMap, r->temperature, sizeof(r->temperature));
+  memcpy(column.humidityMap, r->humidity, sizeof(r->humidity));
+  memcpy(column.beachNoiseMap, r->beachNoise, sizeof(r->beachNoise));
+  memcpy(column.strataShift, r->strataShift, sizeof(r->strataShift));
+  memcpy(column.strataDeep, r->strataDeep, sizeof(r->strataDeep));
+  memcpy(column.strataMid, r->strataMid, sizeof(r->strataMid));
+  for (int x = 0; x < CHUNK_SIZE; ++x) {
+    for (int z = 0; z < CHUNK_SIZE; ++z) {
+      column.biomeMap[x][z] = (Biome)r->biome[x][z];
+      column.setSkyHeight(x, z, r->height[x][z]);
+    }
+  }
+  return true;
+}
+
+void ColumnCache::Store(int cx, int cz, const ChunkColumn &column) {
+  auto record = std::make_unique<Record>();
+  record->cx = cx;
+  record->cz = cz;
+  memcpy(record->height, column.heightMap, sizeof(record->height));
+  memcpy(record->temperature, column.temperatureMap,
+         sizeof(record->temperature));
+  memcpy(record->humidity, column.humidityMap, sizeof(record->humidity));
+  memcpy(record->beachNoise, column.beachNoiseMap,
+         sizeof(record->beachNoise));
+  memcpy(record->strataShift, column.strataShift,
+         sizeof(record->strataShift));
+  memcpy(record->strataDeep, column.strataDeep, sizeof(record->strataDeep));
+  memcpy(record->strataMid, column.strataMid, sizeof(record->strataMid));
+  for (int x = 0; x < CHUNK_SIZE; ++x)
+    for (int z = 0; z < CHUNK_SIZE; ++z)
+      record->biome[x][z] = (uint8_t)column.biomeMap[x][z];
+
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  uint64_t key = Key(cx, cz);
+  if (m_Index.count(key))
+    return; // Another generator got there first
+  if (m_FileSize + sizeof(Record) > MAX_TOTAL_BYTES)
+    return; // Full; what is cached keeps being served
+
+  m_File.seekp((std::streamoff)m_FileSize);
+  m_File.write((const char *)record.get(), sizeof(Record));
+  if (!m_File) {
+    m_File.clear();
+    return;
+  }
+  m_Index[key] = m_FileSize;
+  m_FileSize += sizeof(Record);
+}
+
+size_t ColumnCache::GetColumnCount() {
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_Index.size();
+}
@@ -0,0 +1,71 @@
+#ifndef COLUMN_CACHE_H
+#define COLUMN_CACHE_H
+
+#include "WorldGenConfig.h"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+struct ChunkColumn;
+
+// Persistent cache of the 2D column maps (height, biome, climate, beach and
+// strata), which depend on nothing but the WorldGenConfig. Each config hash
+// gets one file of fixed-size records. Records already in the file when it
+// is opened are memory-mapped and copied straight out of the mapping;
+// columns generated afterwards are appended. Records are in host byte
+// order, so a cache is not portable between machines; anything it can't
+// validate (including a different WorldGenerator::GENERATOR_VERSION) is
+// started over. The directory is kept under MAX_TOTAL_BYTES by deleting
+// the least recently opened files. Thread-safe.
+class ColumnCache {
+public:
+  static const uint64_t MAX_TOTAL_BYTES = 256ULL << 20;
+
+  // Cache for 'config' in 'directory', shared by every user of the same
+  // file in this process. Null if the file can't be created.
+  static std::shared_ptr<ColumnCache> Open(const std::string &directory,
+                                           const WorldGenConfig &config);
+  ~ColumnCache();
+
+  // Fill the generated maps (and initial sky heights) of column (cx, cz).
+  // False if it is not cached.
+  bool Load(int cx, int cz, ChunkColumn &column);
+  // Append a freshly generated column
+  void Store(int cx, int cz, const ChunkColumn &column);
+  size_t GetColumnCount();
+
+private:
+  struct Header;
+  struct Record; // On-disk layout, see ColumnCache.cpp
+
+  ColumnCache() = default;
+  // Delete the oldest cache files in 'directory' other than 'keep' and
+  // those open in this process until the total fits MAX_TOTAL_BYTES
+  static void Prune(const std::string &directory, const std::string &keep,
+                    const std::map<std::string, std::weak_ptr<ColumnCache>>
+                        &open);
+  bool OpenFile(const std::string &path, uint64_t configHash);
+  void MapFile(const std::string &path);
+  // Reads past the mapping go through m_File; caller holds m_Mutex
+  bool ReadRecord(uint64_t offset, Record &record);
+
+  static uint64_t Key(int cx, int cz) {
+    return ((uint64_t)(uint32_t)cx << 32) | (uint32_t)cz;
+  }
+
+  std::mutex m_Mutex;
+  std::fstream m_File;
+  uint64_t m_FileSize = 0;                        // Header included
+  std::unordered_map<uint64_t, uint64_t> m_Index; // Key -> record offset
+
+  // Records present at open; read-only and never remapped
+  const uint8_t *m_Mapped = nullptr;
+  uint64_t m_MappedSize = 0;
+};
+
+#endif
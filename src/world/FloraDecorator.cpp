@@ -1,63 +1,90 @@
 #include "FloraDecorator.h"
 #include "Block.h"
+#include "WorldGenRandom.h"
 #include "WorldGenerator.h"
-#include <cstdlib>
 #include <glm/glm.hpp>
 
 #include "ChunkColumn.h"
 
-void FloraDecorator::Decorate(Chunk &chunk, WorldGenerator &generator,
-                              const ChunkColumn &column) {
-  glm::ivec3 pos = chunk.chunkPosition;
+void FloraDecorator::PlanStructures(WorldGenerator &generator,
+                                    const ChunkColumn &column, int cx, int cz,
+                                    std::vector<ColumnStructure> &out) {
+  int seed = generator.GetSeed();
+  float density = generator.GetConfig().floraDensity;
 
   for (int x = 0; x < CHUNK_SIZE; ++x) {
     for (int z = 0; z < CHUNK_SIZE; ++z) {
-      int gx = pos.x * CHUNK_SIZE + x;
-      int gz = pos.z * CHUNK_SIZE + z;
+      int gx = cx * CHUNK_SIZE + x;
+      int gz = cz * CHUNK_SIZE + z;
 
       int height = column.getHeight(x, z);
+      if (height < generator.GetConfig().seaLevel)
+        continue; // Above water only
+
       int decorY = height + 1;
-      int localY = decorY - pos.y * CHUNK_SIZE;
-
-      // Only decorate if the decoration block itself is in this chunk
-      if (localY >= 0 && localY < CHUNK_SIZE) {
-        if (height < generator.GetConfig().seaLevel)
-          continue; // Above water only
-
-        Biome biome = column.getBiome(x, z);
-        BlockType surface = generator.GetSurfaceBlock(gx, height, gz, true);
-
-        if (biome == BIOME_DESERT) {
-          if (surface == SAND) {
-            int r = rand() % 100;
-            float density = generator.GetConfig().floraDensity;
-            if (r < density * 0.2f) { // 2% Dead Bush (relative)
-              chunk.setBlock(x, localY, z, DEAD_BUSH);
-            } else if (r < density) { // 8% Dry Short Grass
-              chunk.setBlock(x, localY, z, DRY_SHORT_GRASS);
-            } else if (r < density * 1.2f) { // 2% Dry Tall Grass
-              chunk.setBlock(x, localY, z, DRY_TALL_GRASS);
-            }
-          }
-        } else if (biome == BIOME_PLAINS) {
-          if (surface == GRASS) {
-            int r = rand() % 100;
-            float density = generator.GetConfig().floraDensity;
-            if (r < density) { // 10% Grass
-              chunk.setBlock(x, localY, z, TALL_GRASS);
-            } else if (r < density + 2) { // 2% Rose
-              chunk.setBlock(x, localY, z, ROSE);
-            }
-          }
-        } else if (biome == BIOME_FOREST) {
-          if (surface == GRASS) {
-            if ((rand() % 100) < (generator.GetConfig().floraDensity *
-                                  0.5f)) { // 5% Grass (less than plains)
-              chunk.setBlock(x, localY, z, TALL_GRASS);
-            }
-          }
+      // One roll per surface position
+      int r = WorldGenRandom::At(seed, gx, decorY, gz,
+                                 WorldGenRandom::SALT_FLORA, 100);
+
+      BlockType plant = AIR;
+      BlockType needs = GRASS;
+      Biome biome = column.getBiome(x, z);
+      if (biome == BIOME_DESERT) {
+        needs = SAND;
+        if (r < density * 0.2f) { // 2% Dead Bush (relative)
+          plant = DEAD_BUSH;
+        } else if (r < density) { // 8% Dry Short Grass
+          plant = DRY_SHORT_GRASS;
+        } else if (r < density * 1.2f) { // 2% Dry Tall Grass
+          plant = DRY_TALL_GRASS;
         }
+      } else if (biome == BIOME_PLAINS) {
+        if (r < density) { // 10% Grass
+          plant = TALL_GRASS;
+        } else if (r < density + 2) { // 2% Rose
+          plant = ROSE;
+        }
+      } else if (biome == BIOME_FOREST) {
+        if (r < density * 0.5f) // 5% Grass (less than plains)
+          plant = TALL_GRASS;
       }
+      if (plant == AIR)
+        continue;
+
+      // Surface check last: it may probe the cave noise
+      BlockType surface = generator.GetSurfaceBlock(
+          gx, height, gz, height, column.temperatureMap[x][z],
+          column.humidityMap[x][z], column.beachNoiseMap[x][z], &column, true);
+      if (surface != needs)
+        continue;
+
+      ColumnStructure s;
+      s.type = STRUCTURE_PLANT;
+      s.block = plant;
+      s.size = 1;
+      s.root = glm::ivec3(gx, height, gz);
+      s.min = s.max = glm::ivec3(gx, decorY, gz);
+      out.push_back(s);
     }
   }
 }
+
+void FloraDecorator::Decorate(Chunk &chunk, WorldGenerator &generator,
+                              const ChunkColumn &column) {
+  glm::ivec3 lo = chunk.chunkPosition * CHUNK_SIZE;
+
+  for (const ColumnStructure &s : column.structures) {
+    if (s.type != STRUCTURE_PLANT)
+      continue;
+
+    // Only decorate if the decoration block itself is in this chunk
+    glm::ivec3 l = s.min - lo;
+    if (l.y < 0 || l.y >= CHUNK_SIZE || l.x < 0 || l.x >= CHUNK_SIZE ||
+        l.z < 0 || l.z >= CHUNK_SIZE)
+      continue;
+
+    // Trees are stamped first; don't replace a trunk
+    if (chunk.getBlock(l.x, l.y, l.z).getType() == AIR)
+      chunk.setBlock(l.x, l.y, l.z, s.block);
+  }
+}
@@ -0,0 +1,394 @@
+#include "LightEngine.h"
+#include "Chunk.h"
+#include "ChunkColumn.h"
+#include "World.h"
+#include "../debug/Profiler.h"
+#include <algorithm>
+#include <tuple>
+
+// Per Chunk::DIR_* index: index delta inside the chunk, bit position of the
+// moving coordinate, the coordinate value on the border being crossed and
+// the index delta when wrapping into the neighbour chunk
+struct DirStep {
+  int offset;
+  int shift;
+  int edge;
+  int wrap;
+};
+static const int LAST = CHUNK_SIZE - 1;
+static const DirStep DIR_STEPS[6] = {
+    {1, 0, LAST, -LAST},                // Front (Z+)
+    {-1, 0, 0, LAST},                   // Back (Z-)
+    {-(1 << 10), 10, 0, LAST << 10},    // Left (X-)
+    {1 << 10, 10, LAST, -(LAST << 10)}, // Right (X+)
+    {1 << 5, 5, LAST, -(LAST << 5)},    // Top (Y+)
+    {-(1 << 5), 5, 0, LAST << 5}};      // Bottom (Y-)
+
+static int packIndex(int x, int y, int z) { return (x << 10) | (y << 5) | z; }
+
+static int floorDivChunk(int v) {
+  return (v >= 0) ? (v / CHUNK_SIZE) : ((v - CHUNK_SIZE + 1) / CHUNK_SIZE);
+}
+
+static uint8_t &lightOf(ChunkBlock &b, bool sky) {
+  return sky ? b.skyLight : b.blockLight;
+}
+
+void LightEngine::NodeQueue::grow() {
+  std::vector<LightNode> bigger(buffer.size() * 2);
+  size_t count = tail - head;
+  for (size_t i = 0; i < count; ++i)
+    bigger[i] = buffer[(head + i) & mask];
+  buffer.swap(bigger);
+  mask = buffer.size() - 1;
+  head = 0;
+  tail = count;
+}
+
+LightEngine::LightEngine(World &world) : world(world) {}
+
+ChunkBlock &LightEngine::voxel(const LightNode &n) {
+  return (&n.chunk->blocks[0][0][0])[n.index];
+}
+
+bool LightEngine::step(const LightNode &from, int dir, LightNode &to) {
+  const DirStep &s = DIR_STEPS[dir];
+  if (((from.index >> s.shift) & LAST) != s.edge) {
+    to.chunk = from.chunk;
+    to.index = (uint16_t)(from.index + s.offset);
+    return true;
+  }
+  to.chunk = from.chunk->neighbors[dir];
+  if (!to.chunk || !to.chunk->lightReady)
+    return false;
+  to.index = (uint16_t)(from.index + s.wrap);
+  return true;
+}
+
+void LightEngine::markDirty(const LightNode &n) {
+  Chunk *c = n.chunk;
+  dirtyChunks.insert(c);
+
+  // Border voxels are also sampled by the neighbour's mesher
+  for (int d = 0; d < 6; ++d) {
+    const DirStep &s = DIR_STEPS[d];
+    if (((n.index >> s.shift) & LAST) == s.edge && c->neighbors[d])
+      dirtyChunks.insert(c->neighbors[d]);
+  }
+}
+
+bool LightEngine::isOpenToSky(const Chunk *c, int x, int z) const {
+  // Top voxel of a column with nothing loaded above it
+  if (c->chunkPosition.y + 1 >= world.config.worldHeight / CHUNK_SIZE)
+    return true;
+  int topGY = c->chunkPosition.y * CHUNK_SIZE + (CHUNK_SIZE - 1);
+  if (const ChunkColumn *column = c->getColumn())
+    return topGY > column->getSkyHeight(x, z);
+  int gx = c->chunkPosition.x * CHUNK_SIZE + x;
+  int gz = c->chunkPosition.z * CHUNK_SIZE + z;
+  return topGY > world.getHeight(gx, gz);
+}
+
+void LightEngine::onBlockChanged(int x, int y, int z) {
+  std::lock_guard<std::mutex> lock(lightMutex);
+  applyChange(x, y, z);
+  propagate(true);
+}
+
+void LightEngine::queueBlockChange(int x, int y, int z) {
+  std::lock_guard<std::mutex> lock(lightMutex);
+  pendingChanges.emplace_back(x, y, z);
+}
+
+void LightEngine::flushChanges(const std::unordered_set<Chunk *> &remesh) {
+  std::lock_guard<std::mutex> lock(lightMutex);
+
+  // Repeated edits of one voxel only need relighting once
+  std::sort(pendingChanges.begin(), pendingChanges.end(),
+            [](const glm::ivec3 &a, const glm::ivec3 &b) {
+              return std::tie(a.x, a.y, a.z) < std::tie(b.x, b.y, b.z);
+            });
+  pendingChanges.erase(
+      std::unique(pendingChanges.begin(), pendingChanges.end()),
+      pendingChanges.end());
+
+  // Removals run per edit against the old light; the add pass that refills
+  // everything runs once for the whole batch
+  for (const glm::ivec3 &p : pendingChanges)
+    applyChange(p.x, p.y, p.z);
+  pendingChanges.clear();
+
+  dirtyChunks.insert(remesh.begin(), remesh.end());
+  propagate(true);
+}
+
+void LightEngine::applyChange(int x, int y, int z) {
+  int cx = floorDivChunk(x);
+  int cy = floorDivChunk(y);
+  int cz = floorDivChunk(z);
+  Chunk *c = world.getChunk(cx, cy, cz);
+  if (!c || !c->lightReady)
+    return; // Lit with the rest of its column once that is complete
+
+  int lx = x - cx * CHUNK_SIZE;
+  int ly = y - cy * CHUNK_SIZE;
+  int lz = z - cz * CHUNK_SIZE;
+  LightNode origin{c, (uint16_t)packIndex(lx, ly, lz), 0};
+  ChunkBlock &b = voxel(origin);
+
+  for (int channel = SKY; channel <= BLOCK; ++channel) {
+    bool sky = channel == SKY;
+
+    // 1. Take out whatever light used to pass through this voxel
+    uint8_t &level = lightOf(b, sky);
+    if (level > 0) {
+      removeQueues[channel].push({c, origin.index, level});
+      level = 0;
+      markDirty(origin);
+    }
+    removeLight(channel);
+
+    // 2. Seed the voxel itself (emitters, or open sky with nothing above)
+    uint8_t seed = 0;
+    if (!sky) {
+      seed = b.getEmission();
+    } else if (!b.isOpaque() && ly == CHUNK_SIZE - 1 &&
+               !c->neighbors[Chunk::DIR_TOP] && isOpenToSky(c, lx, lz)) {
+      seed = (b.getType() == WATER) ? 13 : 15;
+    }
+    if (seed > level) {
+      level = seed;
+      addQueues[channel].push({c, origin.index, seed});
+      markDirty(origin);
+    }
+
+    // 3. Let lit neighbours flow back in if the voxel is see-through now
+    if (!b.isOpaque()) {
+      for (int d = 0; d < 6; ++d) {
+        LightNode n;
+        if (!step(origin, d, n))
+          continue;
+        uint8_t nl = lightOf(voxel(n), sky);
+        if (nl > 0) {
+          n.level = nl;
+          addQueues[channel].push(n);
+        }
+      }
+    }
+  }
+}
+
+void LightEngine::onChunkLinked(Chunk *c) {
+  ChunkColumn *column = c->getColumn();
+  if (!column)
+    return;
+  int chunksY = world.config.worldHeight / CHUNK_SIZE;
+  if (++column->linkedChunks < chunksY)
+    return;
+
+  Chunk *bottom = c;
+  while (bottom->neighbors[Chunk::DIR_BOTTOM])
+    bottom = bottom->neighbors[Chunk::DIR_BOTTOM];
+  lightColumn(bottom);
+}
+
+void LightEngine::onChunkUnlinked(Chunk *c) {
+  if (ChunkColumn *column = c->getColumn())
+    --column->linkedChunks;
+  c->lightReady = false;
+}
+
+void LightEngine::lightColumn(Chunk *bottom) {
+  PROFILE_SCOPE("Light Column");
+  columnChunks.clear();
+  for (Chunk *c = bottom; c; c = c->neighbors[Chunk::DIR_TOP])
+    columnChunks.push_back(c);
+  if (columnChunks.size() * CHUNK_SIZE < (size_t)world.config.worldHeight)
+    return; // A link is missing; the last chunk to arrive will retry
+
+  ChunkColumn *column = bottom->getColumn();
+  for (Chunk *c : columnChunks) {
+    ChunkBlock *flat = &c->blocks[0][0][0];
+    for (int i = 0; i < CHUNK_SIZE * CHUNK_SIZE * CHUNK_SIZE; ++i)
+      flat[i].skyLight = 0;
+    c->calculateBlockLight();
+  }
+
+  // Sunlight falls from the top of the world until the first opaque block,
+  // losing 2 per water block. Above the column's sky height no voxel can be
+  // opaque, so only water needs checking there; below it we look for the
+  // real top block (caves may have carved the terrain surface away) and
+  // store it back into the heightmap.
+  int worldTop = (int)columnChunks.size() * CHUNK_SIZE - 1;
+  for (int x = 0; x < CHUNK_SIZE; ++x) {
+    for (int z = 0; z < CHUNK_SIZE; ++z) {
+      int height = column ? column->getSkyHeight(x, z) : worldTop;
+      int light = 15;
+      int gy = worldTop;
+      for (; gy >= 0 && light > 0; --gy) {
+        Chunk *c = columnChunks[gy / CHUNK_SIZE];
+        ChunkBlock &b = c->blocks[x][gy % CHUNK_SIZE][z];
+        if (gy <= height && b.isOpaque())
+          break;
+        if (b.getType() == WATER)
+          light = std::max(light - 2, 0);
+        b.skyLight = (uint8_t)light;
+      }
+      if (column && light > 0)
+        column->setSkyHeight(x, z, gy);
+    }
+  }
+
+  for (Chunk *c : columnChunks) {
+    c->lightReady = true;
+    dirtyChunks.insert(c);
+  }
+  for (Chunk *c : columnChunks)
+    queueChunkSeeds(c);
+
+  propagate(false);
+}
+
+void LightEngine::queueChunkSeeds(Chunk *c) {
+  // Sunlit columns are already complete top to bottom, so sky light only
+  // needs to spread from voxels that can lose it: ones on the chunk border
+  // or next to a darker see-through voxel. Block light is only set on
+  // emitters at this point, so every lit voxel is a seed.
+  static const int HORIZONTAL[4] = {1 << 10, -(1 << 10), 1, -1};
+  const ChunkBlock *flat = &c->blocks[0][0][0];
+  const int volume = CHUNK_SIZE * CHUNK_SIZE * CHUNK_SIZE;
+  for (int i = 0; i < volume; ++i) {
+    const ChunkBlock &b = flat[i];
+    if (b.blockLight > 1)
+      addQueues[BLOCK].push({c, (uint16_t)i, b.blockLight});
+
+    int sky = b.skyLight;
+    if (sky <= 1)
+      continue;
+    int x = i >> 10, y = (i >> 5) & LAST, z = i & LAST;
+    bool seed = x == 0 || x == LAST || y == 0 || y == LAST || z == 0 ||
+                z == LAST;
+    for (int h = 0; h < 4 && !seed; ++h) {
+      const ChunkBlock &nb = flat[i + HORIZONTAL[h]];
+      seed = nb.skyLight < sky - 1 && !nb.isOpaque();
+    }
+    if (seed)
+      addQueues[SKY].push({c, (uint16_t)i, (uint8_t)sky});
+  }
+
+  // Lit voxels on the facing layer of each neighbour flow back into c
+  for (int d = 0; d < 6; ++d) {
+    Chunk *n = c->neighbors[d];
+    if (!n || !n->lightReady)
+      continue;
+    const DirStep &s = DIR_STEPS[d];
+    // The neighbour's layer touching c is the opposite border to 'edge'
+    int layer = LAST - s.edge;
+    int uShift = (s.shift == 0) ? 10 : 0;
+    int vShift = (s.shift == 5) ? 10 : 5;
+    const ChunkBlock *nflat = &n->blocks[0][0][0];
+    for (int u = 0; u < CHUNK_SIZE; ++u) {
+      for (int v = 0; v < CHUNK_SIZE; ++v) {
+        int i = (layer << s.shift) | (u << uShift) | (v << vShift);
+        const ChunkBlock &b = nflat[i];
+        if (b.skyLight > 1)
+          addQueues[SKY].push({n, (uint16_t)i, b.skyLight});
+        if (b.blockLight > 1)
+          addQueues[BLOCK].push({n, (uint16_t)i, b.blockLight});
+      }
+    }
+  }
+}
+
+void LightEngine::propagate(bool priority) {
+  for (int channel = SKY; channel <= BLOCK; ++channel) {
+    removeLight(channel);
+    addLight(channel);
+  }
+
+  for (Chunk *dirty : dirtyChunks)
+    world.QueueMeshUpdate(dirty, priority);
+  dirtyChunks.clear();
+}
+
+void LightEngine::removeLight(int channel) {
+  bool sky = channel == SKY;
+  NodeQueue &removeQueue = removeQueues[channel];
+  NodeQueue &addQueue = addQueues[channel];
+  while (!removeQueue.empty()) {
+    LightNode node = removeQueue.pop();
+
+    for (int d = 0; d < 6; ++d) {
+      LightNode n;
+      if (!step(node, d, n))
+        continue;
+      ChunkBlock &nb = voxel(n);
+      uint8_t &nl = lightOf(nb, sky);
+      if (nl == 0)
+        continue;
+
+      // Sunlight falls straight down without decaying, so a full column
+      // below a full voxel was fed by it too
+      bool fedByNode = nl < node.level || (sky && d == Chunk::DIR_BOTTOM &&
+                                           node.level == 15 && nl == 15);
+      if (fedByNode) {
+        n.level = nl;
+        nl = 0;
+        removeQueue.push(n);
+        markDirty(n);
+
+        // Emitters keep their own light
+        uint8_t emission = sky ? 0 : nb.getEmission();
+        if (emission > 0) {
+          nl = emission;
+          n.level = emission;
+          addQueue.push(n);
+        }
+      } else {
+        // Lit from elsewhere: refill the cleared region from here
+        n.level = nl;
+        addQueue.push(n);
+      }
+    }
+  }
+}
+
+void LightEngine::addLight(int channel) {
+  bool sky = channel == SKY;
+  NodeQueue &addQueue = addQueues[channel];
+  while (!addQueue.empty()) {
+    LightNode node = addQueue.pop();
+
+    // May have been raised or cleared since it was queued
+    int cur = lightOf(voxel(node), sky);
+    if (cur <= 1)
+      continue;
+
+    for (int d = 0; d < 6; ++d) {
+      LightNode n;
+      if (!step(node, d, n))
+        continue;
+      ChunkBlock &nb = voxel(n);
+      if (nb.isOpaque())
+        continue;
+
+      // Same falloff as the column sweep in lightColumn
+      bool water = nb.getType() == WATER;
+      int next;
+      if (sky && d == Chunk::DIR_BOTTOM && water)
+        next = cur - 2;
+      else if (sky && d == Chunk::DIR_BOTTOM && cur == 15)
+        next = 15;
+      else
+        next = cur - (water ? 3 : 1);
+
+      uint8_t &nl = lightOf(nb, sky);
+      if (next > nl) {
+        nl = (uint8_t)next;
+        n.level = nl;
+        addQueue.push(n);
+        markDirty(n);
+      }
+    }
+  }
+}
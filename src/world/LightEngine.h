@@ -0,0 +1,111 @@
+#ifndef LIGHT_ENGINE_H
+#define LIGHT_ENGINE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+class Chunk;
+class World;
+struct ChunkBlock;
+
+// World-level sky/block light propagation.
+// Light lives in the chunks, but the BFS queues live here and step across
+// chunk borders through the cached neighbor pointers, so a change settles in
+// a single pass no matter how many chunks it reaches. Block edits run a
+// removal BFS for the light that came through the changed voxel followed by
+// an add BFS from the voxels bordering the dark region. Every chunk whose
+// light changed gets one mesh request when the queues are drained.
+class LightEngine {
+public:
+  static const int SKY = 0;
+  static const int BLOCK = 1;
+
+  explicit LightEngine(World &world);
+
+  // Relight around (x, y, z) after its block has been replaced. Queues a
+  // mesh update for every chunk whose light changed.
+  void onBlockChanged(int x, int y, int z);
+
+  // Deferred form for bulk edits: changes are recorded and relit together
+  // by flushChanges(), which also requests meshes for 'remesh' so every
+  // affected chunk gets a single mesh request for the whole batch.
+  void queueBlockChange(int x, int y, int z);
+  void flushChanges(const std::unordered_set<Chunk *> &remesh);
+
+  // Initial lighting is done per column: chunks are counted as they are
+  // linked and, once every chunk of the column is present, sunlight is swept
+  // top-down through the whole column and spread sideways in one pass.
+  // Until then the column's chunks are not light-ready and the BFS does not
+  // enter them. Both calls require the caller to hold getMutex().
+  void onChunkLinked(Chunk *c);
+  void onChunkUnlinked(Chunk *c);
+
+  // Held by anything else that writes light or relinks chunks
+  std::mutex &getMutex() { return lightMutex; }
+
+private:
+  // Voxel index inside a chunk: (x << 10) | (y << 5) | z, which is also the
+  // offset into Chunk::blocks
+  struct LightNode {
+    Chunk *chunk;
+    uint16_t index;
+    uint8_t level;
+  };
+
+  // Preallocated FIFO of nodes. Only grows (doubling) if a single update
+  // outruns the initial capacity, so steady-state BFS never allocates.
+  class NodeQueue {
+  public:
+    explicit NodeQueue(size_t capacity = 1 << 15)
+        : buffer(capacity), mask(capacity - 1) {}
+
+    bool empty() const { return head == tail; }
+    void push(const LightNode &n) {
+      if (tail - head == buffer.size())
+        grow();
+      buffer[tail++ & mask] = n;
+    }
+    LightNode pop() { return buffer[head++ & mask]; }
+
+  private:
+    void grow();
+
+    std::vector<LightNode> buffer; // Power-of-two size
+    size_t mask;
+    size_t head = 0;
+    size_t tail = 0;
+  };
+
+  // Removal BFS for an edited voxel, then queue its new light and the
+  // neighbours that can refill it. Does not run the add pass.
+  void applyChange(int x, int y, int z);
+  // Sweep and seed a complete column, given its bottom chunk
+  void lightColumn(Chunk *bottom);
+  // Queue c's boundary/emissive voxels plus the lit faces of its
+  // light-ready neighbours
+  void queueChunkSeeds(Chunk *c);
+  void removeLight(int channel);
+  void addLight(int channel);
+  // Drains every queue, then requests one mesh per dirty chunk
+  void propagate(bool priority);
+  // Neighbouring voxel in direction 'dir' (Chunk::DIR_*), following the
+  // chunk's neighbour pointers across borders. False if not loaded.
+  static bool step(const LightNode &from, int dir, LightNode &to);
+  static ChunkBlock &voxel(const LightNode &n);
+  void markDirty(const LightNode &n);
+  bool isOpenToSky(const Chunk *c, int x, int z) const;
+
+  World &world;
+  std::mutex lightMutex;
+  NodeQueue removeQueues[2]; // Indexed by SKY / BLOCK
+  NodeQueue addQueues[2];
+  std::unordered_set<Chunk *> dirtyChunks;
+  std::vector<Chunk *> columnChunks; // Scratch for lightColumn, bottom up
+  std::vector<glm::ivec3> pendingChanges;
+};
+
+#endif
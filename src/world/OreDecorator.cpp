@@ -1,7 +1,7 @@
 #include "OreDecorator.h"
 #include "Block.h"
+#include "WorldGenRandom.h"
 #include "WorldGenerator.h"
-#include <cstdlib>
 
 #include "ChunkColumn.h"
 
@@ -9,16 +9,19 @@ void OreDecorator::Decorate(Chunk &chunk, WorldGenerator &generator,
                             const ChunkColumn &column) {
   // Ores spawn underground (Stone)
   // Iterate random attempts per chunk
+  glm::ivec3 pos = chunk.chunkPosition;
+  WorldGenRandom rng(generator.GetSeed(), pos.x, pos.y, pos.z,
+                     WorldGenRandom::SALT_ORE);
 
   // Coal
   for (int i = 0; i < generator.GetConfig().coalAttempts; ++i) {
-    int x = rand() % CHUNK_SIZE;
-    int y = rand() % CHUNK_SIZE;
-    int z = rand() % CHUNK_SIZE;
+    int x = rng.NextInt(CHUNK_SIZE);
+    int y = rng.NextInt(CHUNK_SIZE);
+    int z = rng.NextInt(CHUNK_SIZE);
 
     ChunkBlock b = chunk.getBlock(x, y, z);
     if (b.getType() == STONE) {
-      GenerateOre(chunk, x, y, z, COAL_ORE);
+      GenerateOre(chunk, x, y, z, COAL_ORE, rng);
     }
   }
 
@@ -28,9 +31,9 @@ void OreDecorator::Decorate(Chunk &chunk, WorldGenerator &generator,
   int globalYBase = chunk.chunkPosition.y * CHUNK_SIZE;
 
   for (int i = 0; i < generator.GetConfig().ironAttempts; ++i) {
-    int x = rand() % CHUNK_SIZE;
-    int y = rand() % CHUNK_SIZE;
-    int z = rand() % CHUNK_SIZE;
+    int x = rng.NextInt(CHUNK_SIZE);
+    int y = rng.NextInt(CHUNK_SIZE);
+    int z = rng.NextInt(CHUNK_SIZE);
 
     int gy = globalYBase + y;
 
@@ -41,21 +44,21 @@ void OreDecorator::Decorate(Chunk &chunk, WorldGenerator &generator,
 
     ChunkBlock b = chunk.getBlock(x, y, z);
     if (b.getType() == STONE) {
-      GenerateOre(chunk, x, y, z, IRON_ORE);
+      GenerateOre(chunk, x, y, z, IRON_ORE, rng);
     }
   }
 }
 
 void OreDecorator::GenerateOre(Chunk &chunk, int startX, int startY, int startZ,
-                               BlockType oreType) {
+                               BlockType oreType, WorldGenRandom &rng) {
   // Small cluster of 2-4 blocks
   chunk.setBlock(startX, startY, startZ, oreType);
 
   // Try neighbors
   for (int i = 0; i < 3; ++i) {
-    int dx = (rand() % 3) - 1;
-    int dy = (rand() % 3) - 1;
-    int dz = (rand() % 3) - 1;
+    int dx = rng.NextInt(3) - 1;
+    int dy = rng.NextInt(3) - 1;
+    int dz = rng.NextInt(3) - 1;
 
     int nx = startX + dx;
     int ny = startY + dy;
@@ -3,6 +3,8 @@
 
 #include "WorldDecorator.h"
 
+class WorldGenRandom;
+
 class OreDecorator : public WorldDecorator {
 public:
   virtual void Decorate(Chunk &chunk, WorldGenerator &generator,
@@ -10,7 +12,7 @@ public:
 
 private:
   void GenerateOre(Chunk &chunk, int startX, int startY, int startZ,
-                   BlockType oreType);
+                   BlockType oreType, WorldGenRandom &rng);
 };
 
 #endif
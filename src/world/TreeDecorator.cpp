@@ -3,21 +3,20 @@
 #include "../debug/Profiler.h"
 #include "Block.h"
 #include "ChunkColumn.h"
+#include "WorldGenRandom.h"
 #include "WorldGenerator.h"
-#include <cstdlib>
+#include <algorithm>
 #include <glm/glm.hpp>
 #include <vector>
 
 // Helper for deterministic random based on position and seed
 static int GetPosRand(int x, int z, int seed, int salt) {
-  unsigned int h = (unsigned int)x * 73856093 ^ (unsigned int)z * 19349663 ^
-                   (unsigned int)seed * 83492791 ^ (unsigned int)salt;
-  return (int)(h % 100);
+  return WorldGenRandom::At(seed, x, salt, z, WorldGenRandom::SALT_TREE, 100);
 }
 
 // Tree generation helpers that check chunk bounds
-static void GenerateOak(Chunk &chunk, int gx, int gy, int gz, int seed) {
-  int treeHeight = 4 + (GetPosRand(gx, gz, seed, 1) % 4);
+static void GenerateOak(Chunk &chunk, int gx, int gy, int gz, int treeHeight,
+                        int seed) {
   glm::ivec3 cp = chunk.chunkPosition * CHUNK_SIZE;
 
   // Trunk
@@ -74,8 +73,8 @@ static void GenerateOak(Chunk &chunk, int gx, int gy, int gz, int seed) {
   }
 }
 
-static void GeneratePine(Chunk &chunk, int gx, int gy, int gz, int seed) {
-  int height = 6 + (GetPosRand(gx, gz, seed, 2) % 4); // 6-9
+static void GeneratePine(Chunk &chunk, int gx, int gy, int gz, int height,
+                         int seed) {
   glm::ivec3 cp = chunk.chunkPosition * CHUNK_SIZE;
 
   // Trunk
@@ -126,8 +125,7 @@ static void GeneratePine(Chunk &chunk, int gx, int gy, int gz, int seed) {
   }
 }
 
-static void GenerateCactus(Chunk &chunk, int gx, int gy, int gz, int seed) {
-  int height = 2 + (GetPosRand(gx, gz, seed, 3) % 3); // 2-4
+static void GenerateCactus(Chunk &chunk, int gx, int gy, int gz, int height) {
   glm::ivec3 cp = chunk.chunkPosition * CHUNK_SIZE;
   for (int h = 1; h <= height; ++h) {
     int ly = (gy + h) - cp.y;
@@ -140,26 +138,30 @@ static void GenerateCactus(Chunk &chunk, int gx, int gy, int gz, int seed) {
   }
 }
 
-void TreeDecorator::Decorate(Chunk &chunk, WorldGenerator &generator,
-                             const ChunkColumn &column) {
-  PROFILE_SCOPE_CONDITIONAL("Decorator_Trees", generator.IsProfilingEnabled());
-  glm::ivec3 cp = chunk.chunkPosition;
+// Farthest a tree reaches sideways from its trunk (leaf radius)
+static const int MAX_REACH = 2;
+
+void TreeDecorator::PlanStructures(WorldGenerator &generator,
+                                   const ChunkColumn &column, int cx, int cz,
+                                   std::vector<ColumnStructure> &out) {
+  PROFILE_SCOPE_CONDITIONAL("Decorator_Trees_Plan",
+                            generator.IsProfilingEnabled());
+  const WorldGenConfig &config = generator.GetConfig();
   int seed = generator.GetSeed();
 
-  // Search a radius of 5 around the chunk for potential tree starts
-  int searchRadius = 5;
-  const int GRID_SIZE = CHUNK_SIZE + (searchRadius * 2); // 42x42
-  int startGX = cp.x * CHUNK_SIZE - searchRadius;
-  int startGZ = cp.z * CHUNK_SIZE - searchRadius;
+  // Trees rooted up to MAX_REACH blocks outside the column still overhang it
+  const int GRID_SIZE = CHUNK_SIZE + MAX_REACH * 2;
+  int startGX = cx * CHUNK_SIZE - MAX_REACH;
+  int startGZ = cz * CHUNK_SIZE - MAX_REACH;
 
   // 1. Batch generate noise for the entire search area using synced methods
-  std::vector<float> heightGrid(GRID_SIZE * GRID_SIZE);
+  std::vector<int> heightGrid(GRID_SIZE * GRID_SIZE);
   std::vector<float> tempGrid(GRID_SIZE * GRID_SIZE);
   std::vector<float> humidGrid(GRID_SIZE * GRID_SIZE);
   std::vector<float> beachGrid(GRID_SIZE * GRID_SIZE);
 
-  generator.GenerateHeightGrid(heightGrid.data(), startGX, startGZ, GRID_SIZE,
-                               GRID_SIZE);
+  generator.GenerateHeightMap(heightGrid.data(), startGX, startGZ, GRID_SIZE,
+                              GRID_SIZE);
   generator.GenerateTemperatureGrid(tempGrid.data(), startGX, startGZ,
                                     GRID_SIZE, GRID_SIZE);
   generator.GenerateHumidityGrid(humidGrid.data(), startGX, startGZ, GRID_SIZE,
@@ -167,85 +169,100 @@ void TreeDecorator::Decorate(Chunk &chunk, WorldGenerator &generator,
   generator.GenerateBeachGrid(beachGrid.data(), startGX, startGZ, GRID_SIZE,
                               GRID_SIZE);
 
-  for (int gx = startGX; gx < startGX + GRID_SIZE; ++gx) {
-    for (int gz = startGZ; gz < startGZ + GRID_SIZE; ++gz) {
+  for (int gz = startGZ; gz < startGZ + GRID_SIZE; ++gz) {
+    for (int gx = startGX; gx < startGX + GRID_SIZE; ++gx) {
       int localIdx = (gx - startGX) + (gz - startGZ) * GRID_SIZE;
-
-      // Use batched noise for EXACT synchronization
-      float hNoise = heightGrid[localIdx];
-      float lNoise =
-          generator.GetLandformNoise(gx, gz); // Single lookup ok here
-      int height = generator.CalculateHeightFromNoise(hNoise, lNoise);
-
-      // Apply River Carving for total height alignment
-      if (generator.GetConfig().enableRivers) {
-        float carve = generator.GetRiverCarveFactor(gx, gz);
-        if (carve > 0.0f) {
-          float hToSea = (float)(height - generator.GetConfig().seaLevel);
-          height -=
-              (int)(std::max(generator.GetConfig().riverDepth, hToSea + 2.0f) *
-                    carve);
-        }
-      }
+      int lx = gx - cx * CHUNK_SIZE;
+      int lz = gz - cz * CHUNK_SIZE;
+      bool inColumn =
+          lx >= 0 && lx < CHUNK_SIZE && lz >= 0 && lz < CHUNK_SIZE;
 
       float temp = tempGrid[localIdx];
       float humid = humidGrid[localIdx];
       float beach = beachGrid[localIdx];
-      Biome biome = generator.GetBiomeAtHeight(gx, gz, height, temp, humid);
-
-      if (height < generator.GetConfig().seaLevel)
+      // Same height kernel as GenerateColumn, so border trees line up
+      int height = inColumn ? column.heightMap[lx][lz] : heightGrid[localIdx];
+      if (height < config.seaLevel)
         continue;
 
-      // Use the pre-computed column if within bounds, otherwise pass nullptr
-      int lx = gx - cp.x * CHUNK_SIZE;
-      int lz = gz - cp.z * CHUNK_SIZE;
-      const ChunkColumn *colPtr =
-          (lx >= 0 && lx < CHUNK_SIZE && lz >= 0 && lz < CHUNK_SIZE) ? &column
-                                                                     : nullptr;
+      Biome biome =
+          inColumn ? column.biomeMap[lx][lz]
+                   : generator.GetBiomeAtHeight(gx, gz, height, temp, humid);
 
-      BlockType surface = generator.GetSurfaceBlock(
-          gx, height, gz, height, temp, humid, beach, colPtr, true);
       // We use different salts for different biomes to avoid identical layouts
       int roll = GetPosRand(gx, gz, seed, 100);
-
-      if (biome == BIOME_DESERT) {
-        if (surface == SAND && roll < generator.GetConfig().cactusDensity) {
-          GenerateCactus(chunk, gx, height, gz, seed);
-        }
-      } else if (biome == BIOME_TUNDRA) {
-        if ((surface == SNOW || surface == GRASS || surface == DIRT) &&
-            roll < generator.GetConfig().pineDensity) {
-          GeneratePine(chunk, gx, height, gz, seed);
-          // Note: Ground flattening (SNOW->DIRT) only handled if trunk in THIS
-          // chunk
-          int lx = gx - cp.x * CHUNK_SIZE;
-          int ly = height - cp.y * CHUNK_SIZE;
-          int lz = gz - cp.z * CHUNK_SIZE;
-          if (lx >= 0 && lx < CHUNK_SIZE && ly >= 0 && ly < CHUNK_SIZE &&
-              lz >= 0 && lz < CHUNK_SIZE)
-            chunk.setBlock(lx, ly, lz, DIRT);
-        }
-      } else if (biome == BIOME_FOREST) {
-        if (surface == GRASS && roll < generator.GetConfig().oakDensity) {
-          GenerateOak(chunk, gx, height, gz, seed);
-          int lx = gx - cp.x * CHUNK_SIZE;
-          int ly = height - cp.y * CHUNK_SIZE;
-          int lz = gz - cp.z * CHUNK_SIZE;
-          if (lx >= 0 && lx < CHUNK_SIZE && ly >= 0 && ly < CHUNK_SIZE &&
-              lz >= 0 && lz < CHUNK_SIZE)
-            chunk.setBlock(lx, ly, lz, DIRT);
-        }
-      } else if (biome == BIOME_PLAINS) {
-        if (surface == GRASS && roll < 1) {
-          GenerateOak(chunk, gx, height, gz, seed);
-          int lx = gx - cp.x * CHUNK_SIZE;
-          int ly = height - cp.y * CHUNK_SIZE;
-          int lz = gz - cp.z * CHUNK_SIZE;
-          if (lx >= 0 && lx < CHUNK_SIZE && ly >= 0 && ly < CHUNK_SIZE &&
-              lz >= 0 && lz < CHUNK_SIZE)
-            chunk.setBlock(lx, ly, lz, DIRT);
-        }
+      ColumnStructure tree;
+      int reach = MAX_REACH;
+      if (biome == BIOME_DESERT && roll < config.cactusDensity) {
+        tree.type = STRUCTURE_CACTUS;
+        tree.size = 2 + (GetPosRand(gx, gz, seed, 3) % 3); // 2-4
+        reach = 0;
+      } else if (biome == BIOME_TUNDRA && roll < config.pineDensity) {
+        tree.type = STRUCTURE_PINE;
+        tree.size = 6 + (GetPosRand(gx, gz, seed, 2) % 4); // 6-9
+      } else if ((biome == BIOME_FOREST && roll < config.oakDensity) ||
+                 (biome == BIOME_PLAINS && roll < 1)) {
+        tree.type = STRUCTURE_OAK;
+        tree.size = 4 + (GetPosRand(gx, gz, seed, 1) % 4);
+      } else {
+        continue;
       }
+
+      // Cacti can't overhang, so only their own column plans them
+      if (!inColumn && reach == 0)
+        continue;
+
+      // Surface check last: it may probe the cave noise
+      BlockType surface = generator.GetSurfaceBlock(
+          gx, height, gz, height, temp, humid, beach,
+          inColumn ? &column : nullptr, true);
+      bool valid = false;
+      if (tree.type == STRUCTURE_CACTUS)
+        valid = surface == SAND;
+      else if (tree.type == STRUCTURE_PINE)
+        valid = surface == SNOW || surface == GRASS || surface == DIRT;
+      else
+        valid = surface == GRASS;
+      if (!valid)
+        continue;
+
+      tree.root = glm::ivec3(gx, height, gz);
+      tree.min = glm::ivec3(gx - reach, height, gz - reach);
+      tree.max = glm::ivec3(gx + reach, height + tree.size + 1, gz + reach);
+      out.push_back(tree);
     }
   }
 }
+
+void TreeDecorator::Decorate(Chunk &chunk, WorldGenerator &generator,
+                             const ChunkColumn &column) {
+  PROFILE_SCOPE_CONDITIONAL("Decorator_Trees", generator.IsProfilingEnabled());
+  int seed = generator.GetSeed();
+  glm::ivec3 lo = chunk.chunkPosition * CHUNK_SIZE;
+  glm::ivec3 hi = lo + glm::ivec3(CHUNK_SIZE - 1);
+
+  // Stamp the part of every planned tree that falls inside this chunk
+  for (const ColumnStructure &s : column.structures) {
+    if (s.type == STRUCTURE_PLANT)
+      continue;
+    if (s.max.x < lo.x || s.min.x > hi.x || s.max.y < lo.y ||
+        s.min.y > hi.y || s.max.z < lo.z || s.min.z > hi.z)
+      continue;
+
+    const glm::ivec3 &r = s.root;
+    if (s.type == STRUCTURE_CACTUS) {
+      GenerateCactus(chunk, r.x, r.y, r.z, s.size);
+      continue;
+    }
+    if (s.type == STRUCTURE_PINE)
+      GeneratePine(chunk, r.x, r.y, r.z, s.size, seed);
+    else
+      GenerateOak(chunk, r.x, r.y, r.z, s.size, seed);
+
+    // Ground under the trunk becomes dirt
+    glm::ivec3 l = r - lo;
+    if (l.x >= 0 && l.x < CHUNK_SIZE && l.y >= 0 && l.y < CHUNK_SIZE &&
+        l.z >= 0 && l.z < CHUNK_SIZE)
+      chunk.setBlock(l.x, l.y, l.z, DIRT);
+  }
+}
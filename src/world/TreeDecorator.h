@@ -7,6 +7,10 @@ class TreeDecorator : public WorldDecorator {
 public:
   virtual void Decorate(Chunk &chunk, WorldGenerator &generator,
                         const struct ChunkColumn &column) override;
+  virtual void PlanStructures(WorldGenerator &generator,
+                              const struct ChunkColumn &column, int cx,
+                              int cz,
+                              std::vector<ColumnStructure> &out) override;
 };
 
 #endif
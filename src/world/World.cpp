@@ -3,9 +3,11 @@
 #include "../debug/Profiler.h"
 #include "../ecs/Systems.h"
 #include "../render/Shader.h"
+#include "ColumnCache.h"
 #include "WorldGenerator.h"
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cmath>
 #include <glm/gtc/matrix_access.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -53,23 +55,63 @@ bool isAABBInFrustum(const glm::vec3 &min, const glm::vec3 &max,
   return true;
 }
 
-World::World(const WorldGenConfig &config)
-    : shutdown(false), config(config), worldSeed(config.seed) {
+// Helper for floor division (explicitly defined to avoid ambiguity)
+inline int floorDiv(int a, int b) {
+  return (a >= 0) ? (a / b) : ((a - b + 1) / b);
+}
+
+static uint64_t nowNanos() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Locks 'm'. If another thread holds it, the acquisition is counted as
+// contended and the wait is recorded; the uncontended path costs no more
+// than a plain lock.
+template <typename Mutex>
+static std::unique_lock<Mutex> lockCounted(Mutex &m, LockContention &stats) {
+  std::unique_lock<Mutex> lock(m, std::try_to_lock);
+  if (!lock.owns_lock()) {
+    uint64_t start = nowNanos();
+    lock.lock();
+    stats.contended++;
+    stats.waitNanos += nowNanos() - start;
+  }
+  return lock;
+}
+
+World::World(const WorldGenConfig &config, const WorldOptions &options)
+    : shutdown(false), config(config), worldSeed(config.seed),
+      options(options) {
   LOG_WORLD_INFO("World initialized with Seed: {}", worldSeed);
 
+  // Before any generation worker can ask it for a chunk
+  if (!options.saveDirectory.empty())
+    storage = std::make_unique<ChunkStorage>(options.saveDirectory);
+
   // Start Mesh Threads
-  int numMeshThreads = std::thread::hardware_concurrency();
+  int numMeshThreads = options.meshThreads > 0
+                           ? options.meshThreads
+                           : (int)std::thread::hardware_concurrency();
   if (numMeshThreads < 1)
     numMeshThreads = 1;
 
   // We already use some for generation, maybe balance it?
   // Let's just use hardware_concurrency for meshing as it's the bottleneck.
-  for (int i = 0; i < numMeshThreads; ++i) {
+  for (int i = 0; options.meshing && i < numMeshThreads; ++i) {
     meshThreads.emplace_back(&World::WorkerLoop, this);
   }
 
+  // Fixed-world maps are shared by every generation thread
+  fixedMaps = WorldGenerator::BuildFixedMaps(config);
+  if (!options.columnCacheDirectory.empty())
+    columnCache = ColumnCache::Open(options.columnCacheDirectory, config);
+
   // Start Generation Threads (e.g., 2-4 threads)
-  int numGenThreads = std::thread::hardware_concurrency() / 2;
+  int numGenThreads = options.genThreads > 0
+                          ? options.genThreads
+                          : (int)std::thread::hardware_concurrency() / 2;
   if (numGenThreads < 1)
     numGenThreads = 1;
   for (int i = 0; i < numGenThreads; ++i) {
@@ -93,13 +135,20 @@ World::~World() {
     if (t.joinable())
       t.join();
   }
+
+  // Write back the remaining edits; destroying the storage drains its queue
+  if (storage) {
+    saveUnsavedChunks();
+    storage.reset();
+  }
 }
 
 void World::WorkerLoop() {
   while (true) {
     std::shared_ptr<Chunk> c = nullptr;
     {
-      std::unique_lock<std::mutex> lock(queueMutex);
+      std::unique_lock<std::mutex> lock =
+          lockCounted(queueMutex, meshLockStats);
       condition.wait(lock, [this] {
         return !meshQueue.empty() || !meshQueueHighPrio.empty() || shutdown;
       });
@@ -117,37 +166,71 @@ void World::WorkerLoop() {
         meshQueue.pop_front();
         meshSet.erase(c.get());
       }
+      if (c)
+        activeMeshJobs++;
     }
 
     if (c) {
-      // Recalculate lighting if needed (moved from main thread)
-      if (c->needsLightingUpdate) {
-        c->calculateSunlight();
-        c->calculateBlockLight();
-        c->spreadLight();
-        c->needsLightingUpdate = false;
-      }
-
       // Collecting geometry
+      uint64_t start = nowNanos();
       int opaqueCount = 0;
       std::vector<float> data = c->generateGeometry(opaqueCount);
+      meshNanos += nowNanos() - start;
+      meshesBuilt++;
 
-      // Queue for upload
-      {
+      // Queue for upload (headless worlds have nothing to upload to)
+      if (!options.headless) {
         std::lock_guard<std::mutex> lock(uploadMutex);
         uploadQueue.emplace_back(c, std::move(data), opaqueCount);
       }
+
+      std::lock_guard<std::mutex> lock(queueMutex);
+      activeMeshJobs--;
     }
   }
 }
 
 void World::Tick() {
   currentTick++;
+
+  // Edits made by block updates and entities this tick (liquid spread,
+  // falling blocks landing, ...) are relit and remeshed together below
+  deferBlockUpdates = true;
   updateBlocks();
 
   // ECS Update (Fixed Time Step: 1/20 = 0.05s)
   PhysicsSystem::Update(registry, 0.05f);
   CollisionSystem::Update(registry, *this, 0.05f);
+
+  deferBlockUpdates = false;
+  lightEngine.flushChanges(deferredMeshes);
+  deferredMeshes.clear();
+
+  if (storage && currentTick % AUTOSAVE_TICKS == 0)
+    saveUnsavedChunks();
+}
+
+void World::saveUnsavedChunks() {
+  std::vector<std::shared_ptr<Chunk>> toSave;
+  {
+    std::lock_guard<std::mutex> lock(worldMutex);
+    for (auto &pair : chunks) {
+      if (pair.second->unsaved.exchange(false))
+        toSave.push_back(pair.second);
+    }
+  }
+  // Snapshots are taken outside the world lock
+  for (auto &c : toSave) {
+    storage->saveChunk(*c);
+    c->stored = true;
+  }
+}
+
+void World::requestEditMesh(Chunk *c, bool priority) {
+  if (deferBlockUpdates)
+    deferredMeshes.insert(c);
+  else
+    QueueMeshUpdate(c, priority);
 }
 
 void World::Update() {
@@ -212,10 +295,14 @@ void World::updateBlocks() {
 }
 
 void World::QueueMeshUpdate(Chunk *c, bool priority) {
-  if (c) {
+  if (c && options.meshing) {
     try {
       std::shared_ptr<Chunk> ptr = c->shared_from_this();
-      std::lock_guard<std::mutex> lock(queueMutex);
+      std::unique_lock<std::mutex> lock =
+          lockCounted(queueMutex, meshLockStats);
+      // Queued or already waiting, the next build sees the current
+      // contents; render() must not queue it again for the same change
+      c->meshDirty = false;
       if (meshSet.find(c) == meshSet.end()) {
         // Add to appropriate queue based on priority
         if (priority)
@@ -231,13 +318,68 @@ void World::QueueMeshUpdate(Chunk *c, bool priority) {
   }
 }
 
+ChunkColumn *World::acquireColumn(WorldGenerator &generator, int x, int z) {
+  const int R = WorldGenerator::COLUMN_REGION;
+  std::pair<int, int> region(floorDiv(x, R), floorDiv(z, R));
+  int rx = region.first * R;
+  int rz = region.second * R;
+
+  std::unique_ptr<ChunkColumn> batch[R * R];
+  ChunkColumn *targets[R * R] = {};
+  {
+    std::unique_lock<std::mutex> lock =
+        lockCounted(columnMutex, columnLockStats);
+    // Another worker may already be generating this region
+    auto ready = [&] {
+      return columns.count({x, z}) || !generatingRegions.count(region);
+    };
+    if (!ready()) {
+      uint64_t start = nowNanos();
+      columnCondition.wait(lock, ready);
+      columnLockStats.contended++;
+      columnLockStats.waitNanos += nowNanos() - start;
+    }
+    auto it = columns.find({x, z});
+    if (it != columns.end())
+      return it->second.get();
+
+    // Generate every missing column of the region in one batch; the
+    // neighbouring chunks will need them shortly
+    generatingRegions.insert(region);
+    for (int i = 0; i < R * R; ++i) {
+      if (!columns.count({rx + i % R, rz + i / R})) {
+        batch[i] = std::make_unique<ChunkColumn>();
+        targets[i] = batch[i].get();
+      }
+    }
+  }
+
+  generator.GenerateColumns(targets, rx, rz, R);
+
+  ChunkColumn *column;
+  {
+    std::unique_lock<std::mutex> lock =
+        lockCounted(columnMutex, columnLockStats);
+    for (int i = 0; i < R * R; ++i) {
+      if (batch[i])
+        columns.emplace(std::make_pair(rx + i % R, rz + i / R),
+                        std::move(batch[i]));
+    }
+    generatingRegions.erase(region);
+    column = columns.find({x, z})->second.get();
+  }
+  columnCondition.notify_all();
+  return column;
+}
+
 void World::GenerationWorkerLoop() {
   WorldGenerator generator(config);
-  generator.GenerateFixedMaps();
+  generator.SetFixedMaps(fixedMaps);
+  generator.SetColumnCache(columnCache);
   while (true) {
     std::tuple<int, int, int> coord;
     {
-      std::unique_lock<std::mutex> lock(genMutex);
+      std::unique_lock<std::mutex> lock = lockCounted(genMutex, genLockStats);
       genCondition.wait(lock, [this] { return !genQueue.empty() || shutdown; });
 
       if (shutdown)
@@ -256,7 +398,8 @@ void World::GenerationWorkerLoop() {
 
     // check if already exists (might have been added by another thread)
     {
-      std::lock_guard<std::mutex> lock(worldMutex);
+      std::unique_lock<std::mutex> lock =
+          lockCounted(worldMutex, worldLockStats);
       if (chunks.find(coord) != chunks.end()) {
         // Remove from generating set
         std::lock_guard<std::mutex> gLock(genMutex);
@@ -266,39 +409,33 @@ void World::GenerationWorkerLoop() {
     }
 
     // 1. Ensure Column Exists
-    ChunkColumn *column = nullptr;
-
-    // Optimization: Try to find existing column first
-    {
-      std::lock_guard<std::mutex> lock(columnMutex);
-      auto it = columns.find({x, z});
-      if (it != columns.end()) {
-        column = it->second.get();
-      }
-    }
-
-    // If not found, generate it
-    if (!column) {
-      auto newCol = std::make_unique<ChunkColumn>();
-      generator.GenerateColumn(*newCol, x, z);
-
-      std::lock_guard<std::mutex> lock(columnMutex);
-      // Insert or get existing (if race happened)
-      auto result = columns.emplace(std::make_pair(x, z), std::move(newCol));
-      column = result.first->second.get();
-    }
+    uint64_t genStart = nowNanos();
+    ChunkColumn *column = acquireColumn(generator, x, z);
 
     // 2. Create Chunk
     auto newChunk = std::make_shared<Chunk>();
     newChunk->chunkPosition = glm::ivec3(x, y, z);
     newChunk->setWorld(this);
 
-    // 3. Generate Blocks using Column
-    generator.GenerateChunk(*newChunk, *column);
+    // 3. Load the saved copy, or generate blocks using the column. The
+    // column is still needed for heights, biomes and sky light.
+    if (storage && storage->loadChunk(*newChunk))
+      newChunk->stored = true;
+    else
+      generator.GenerateChunk(*newChunk, *column);
+    newChunk->setColumn(column);
+    newChunk->raiseSkyHeights();
+    genNanos += nowNanos() - genStart;
+
+    // Linking and initial lighting must not interleave with block edits
+    std::unique_lock<std::mutex> lightLock =
+        lockCounted(lightEngine.getMutex(), lightLockStats);
+    uint64_t lightStart = nowNanos();
 
     // 3. Add to World (This links neighbors)
     {
-      std::lock_guard<std::mutex> lock(worldMutex);
+      std::unique_lock<std::mutex> lock =
+          lockCounted(worldMutex, worldLockStats);
       chunks[coord] = std::move(newChunk);
       Chunk *c = chunks[coord].get();
 
@@ -324,38 +461,20 @@ void World::GenerationWorkerLoop() {
 
     Chunk *c = getChunk(x, y, z); // Safe retrieval
     if (c) {
-      // 4. Calculate Light
-      c->calculateSunlight();
-      c->calculateBlockLight();
-
-      // 5. Spread Light (Might need neighboring chunks)
-      c->spreadLight();
-
-      // 6. Queue Mesh (Low Priority for Generation)
-      QueueMeshUpdate(c, false);
-
-      // Also queue neighbors for mesh update if they exist
-      // Also queue neighbors for mesh update if they exist
-      int dirs_indices[] = {Chunk::DIR_FRONT, Chunk::DIR_BACK,
-                            Chunk::DIR_LEFT,  Chunk::DIR_RIGHT,
-                            Chunk::DIR_TOP,   Chunk::DIR_BOTTOM};
+      // 4. Count towards the column; the chunk that completes it lights
+      // the whole column and requests meshes for every chunk it touched
+      lightEngine.onChunkLinked(c);
 
+      // 5. Lit neighbour faces against the new chunk need rebuilding too
       for (int i = 0; i < 6; ++i) {
-        if (c->neighbors[dirs_indices[i]]) {
-          Chunk *n = c->neighbors[dirs_indices[i]];
-
-          // FIX: If we added a chunk ABOVE this neighbor, force it to
-          // re-calculate sunlight because we might have just blocked the sky.
-          if (dirs_indices[i] == Chunk::DIR_BOTTOM) {
-            n->calculateSunlight();
-            n->calculateBlockLight();
-          }
-
-          n->spreadLight();
+        Chunk *n = c->neighbors[i];
+        if (n && n->isLightReady())
           QueueMeshUpdate(n, false);
-        }
       }
     }
+    lightNanos += nowNanos() - lightStart;
+    lightLock.unlock();
+    chunksGenerated++;
 
     // Remove from generating set
     {
@@ -553,6 +672,10 @@ void World::unloadChunks(const glm::vec3 &playerPos, int renderDistance) {
     }
 
     if (chunkToUnload) {
+      // The light engine walks neighbour pointers; never unlink under it
+      std::lock_guard<std::mutex> lightLock(lightEngine.getMutex());
+      lightEngine.onChunkUnlinked(chunkToUnload.get());
+
       // Unlink neighbors
       int dx[] = {0, 0, -1, 1, 0, 0};
       int dy[] = {0, 0, 0, 0, 1, -1};
@@ -595,6 +718,12 @@ void World::unloadChunks(const glm::vec3 &playerPos, int renderDistance) {
         // Note: Can't easily remove from deque
       }
 
+      // Edits would be lost with the chunk, and keeping generated terrain
+      // lets a revisit decompress it instead of generating it again
+      if (storage && (chunkToUnload->unsaved.exchange(false) ||
+                      !chunkToUnload->stored))
+        storage->saveChunk(*chunkToUnload);
+
       // Finally, erase the chunk
       {
         std::lock_guard<std::mutex> lock(worldMutex);
@@ -676,7 +805,7 @@ void World::insertChunk(std::shared_ptr<Chunk> chunk) {
 }
 
 Chunk *World::getChunk(int chunkX, int chunkY, int chunkZ) {
-  std::lock_guard<std::mutex> lock(worldMutex);
+  std::unique_lock<std::mutex> lock = lockCounted(worldMutex, worldLockStats);
   auto key = std::make_tuple(chunkX, chunkY, chunkZ);
   auto it = chunks.find(key);
   if (it != chunks.end())
@@ -685,7 +814,7 @@ Chunk *World::getChunk(int chunkX, int chunkY, int chunkZ) {
 }
 
 const Chunk *World::getChunk(int chunkX, int chunkY, int chunkZ) const {
-  std::lock_guard<std::mutex> lock(worldMutex);
+  std::unique_lock<std::mutex> lock = lockCounted(worldMutex, worldLockStats);
   auto key = std::make_tuple(chunkX, chunkY, chunkZ);
   auto it = chunks.find(key);
   if (it != chunks.end())
@@ -693,11 +822,6 @@ const Chunk *World::getChunk(int chunkX, int chunkY, int chunkZ) const {
   return nullptr;
 }
 
-// Helper for floor division (explicitly defined to avoid ambiguity)
-inline int floorDiv(int a, int b) {
-  return (a >= 0) ? (a / b) : ((a - b + 1) / b);
-}
-
 ChunkBlock World::getBlock(int x, int y, int z) const {
   // Explicit chunk coordinate calculation handles negative coordinates
   // correctly
@@ -821,7 +945,8 @@ void World::setMetadata(int x, int y, int z, uint8_t val) {
   Chunk *c = getChunk(cx, cy, cz);
   if (c) {
     c->setMetadata(lx, ly, lz, val);
-    QueueMeshUpdate(c);
+    c->unsaved = true;
+    requestEditMesh(c, false);
   }
 }
 
@@ -837,71 +962,29 @@ void World::setBlock(int x, int y, int z, BlockType type) {
   Chunk *c = getChunk(cx, cy, cz);
   if (c) {
     c->setBlock(lx, ly, lz, type);
-
-    // Mark for lighting recalculation (done in worker thread)
-    c->needsLightingUpdate = true;
-    QueueMeshUpdate(c, true); // High priority for instant visual feedback
-
-    // Update neighbor chunks
+    c->unsaved = true;
+    updateSkyHeight(c, lx, ly, lz);
+
+    // Relight only the voxels the edit affects (queues their chunks too)
+    if (deferBlockUpdates)
+      lightEngine.queueBlockChange(x, y, z);
+    else
+      lightEngine.onBlockChanged(x, y, z);
+
+    // Geometry of this chunk and of any neighbour sharing the edited face.
+    // Light changes queue their own chunks through the light engine.
+    requestEditMesh(c, true); // High priority for instant visual feedback
     int nDx[] = {-1, 1, 0, 0, 0, 0};
     int nDy[] = {0, 0, -1, 1, 0, 0};
     int nDz[] = {0, 0, 0, 0, -1, 1};
-
+    bool onFace[] = {lx == 0, lx == CHUNK_SIZE - 1, ly == 0,
+                     ly == CHUNK_SIZE - 1, lz == 0, lz == CHUNK_SIZE - 1};
     for (int i = 0; i < 6; ++i) {
+      if (!onFace[i])
+        continue;
       Chunk *n = getChunk(cx + nDx[i], cy + nDy[i], cz + nDz[i]);
-      if (n) {
-        n->needsLightingUpdate = true;
-        QueueMeshUpdate(n, true);
-      }
-    }
-
-    // If we placed a light source, or removed one, we must update neighbors
-    // that light might reach Simple but expensive approach: Update all 6
-    // neighbors + diagonals? For now, let's just stick to immediate neighbors
-    // Light propagation is handled in spreadLight() which pushes to queues.
-    // It sets meshDirty. But now meshDirty does nothing unless we check it.
-    // TODO: Ideally spreadLight should call QueueMeshUpdate instead of just
-    // setting dirty. But spreadLight operates on many chunks.
-
-    // Let's iterate neighbors and queue them if they were touched?
-    // Actually, for simplicity, we rely on the above neighbor check.
-  }
-
-  // Check for light propagation downwards (Sky Light)
-  // If we placed a block, we blocked sky light.
-  // If we removed a block, we opened sky light.
-  // This is handled by calculateSunlight -> but we need to propagate to lower
-  // chunks
-  if (c) {
-    if (type == AIR) {
-      // Block removed - sunlight might go down
-      Chunk *lower = getChunk(cx, cy - 1, cz);
-      if (lower) {
-        lower->calculateSunlight();
-        lower->calculateBlockLight();
-        lower->spreadLight();
-        QueueMeshUpdate(lower, true);
-      }
-    } else {
-      // Block placed - might shadow lower chunk
-      Chunk *lower = getChunk(cx, cy - 1, cz);
-      if (lower) {
-        lower->calculateSunlight();
-        lower->calculateBlockLight();
-        lower->spreadLight();
-        QueueMeshUpdate(lower, true);
-
-        // Also update neighbors of this lower chunk, as light might have spread
-        // to them
-        int nDx[] = {-1, 1, 0, 0};
-        int nDz[] = {0, 0, -1, 1};
-        for (int i = 0; i < 4; ++i) {
-          Chunk *n = getChunk(cx + nDx[i], cy - 1, cz + nDz[i]);
-          if (n) {
-            n->spreadLight();
-          }
-        }
-      }
+      if (n)
+        requestEditMesh(n, true);
     }
 
     // Block Update Logic
@@ -927,6 +1010,42 @@ void World::setBlock(int x, int y, int z, BlockType type) {
   }
 }
 
+void World::updateSkyHeight(Chunk *c, int lx, int ly, int lz) {
+  ChunkColumn *column = c->getColumn();
+  if (!column)
+    return;
+
+  int gy = c->chunkPosition.y * CHUNK_SIZE + ly;
+  int height = column->getSkyHeight(lx, lz);
+  if (c->getBlock(lx, ly, lz).isOpaque()) {
+    if (gy > height)
+      column->setSkyHeight(lx, lz, gy);
+    return;
+  }
+  if (gy != height)
+    return;
+
+  // The top opaque block went away: walk down to the next one
+  Chunk *cur = c;
+  int y = ly - 1;
+  while (true) {
+    for (; y >= 0; --y) {
+      if (cur->getBlock(lx, y, lz).isOpaque()) {
+        column->setSkyHeight(lx, lz, cur->chunkPosition.y * CHUNK_SIZE + y);
+        return;
+      }
+    }
+    Chunk *below = cur->neighbors[Chunk::DIR_BOTTOM];
+    if (!below)
+      break;
+    cur = below;
+    y = CHUNK_SIZE - 1;
+  }
+
+  // Bottom of the world, or an unloaded chunk we treat as solid on top
+  column->setSkyHeight(lx, lz, cur->chunkPosition.y * CHUNK_SIZE - 1);
+}
+
 int World::render(Shader &shader, const glm::mat4 &viewProjection,
                   const glm::vec3 &cameraPos, int renderDistInput) {
   // Collect Visible Chunks under lock
@@ -948,6 +1067,11 @@ int World::render(Shader &shader, const glm::mat4 &viewProjection,
     int minY = 0;
     int maxY = 256 / CHUNK_SIZE;
 
+    // Occluders: solid footprint tiles of nearby columns, merged vertically
+    const int OCCLUDER_RADIUS = 4;
+    const int TILES = Chunk::OCCLUDER_TILES * Chunk::OCCLUDER_TILES;
+    std::vector<OccluderBox> occluders;
+
     {
       PROFILE_SCOPE("Culling & Vis List");
       for (int x = cx - renderDist; x <= cx + renderDist; ++x) {
@@ -960,20 +1084,56 @@ int World::render(Shader &shader, const glm::mat4 &viewProjection,
             continue; // Skip whole column
           }
 
+          bool gatherOccluders = occlusionCulling &&
+                                 std::abs(x - cx) <= OCCLUDER_RADIUS &&
+                                 std::abs(z - cz) <= OCCLUDER_RADIUS;
+          int runStart[TILES]; // World Y where the current solid run began
+          std::fill(runStart, runStart + TILES, -1);
+          auto endRun = [&](int t, int topY) {
+            if (runStart[t] < 0)
+              return;
+            const int tile = Chunk::OCCLUDER_TILE;
+            float tx = (float)(x * CHUNK_SIZE +
+                               (t % Chunk::OCCLUDER_TILES) * tile);
+            float tz = (float)(z * CHUNK_SIZE +
+                               (t / Chunk::OCCLUDER_TILES) * tile);
+            occluders.push_back({glm::vec3(tx, (float)runStart[t], tz),
+                                 glm::vec3(tx + tile, (float)topY, tz + tile)});
+            runStart[t] = -1;
+          };
+
           // 2. Iterate Chunks in Column
           for (int y = minY; y < maxY; ++y) {
             auto it = chunks.find(std::make_tuple(x, y, z));
-            if (it == chunks.end())
-              continue;
+            Chunk *c = (it == chunks.end()) ? nullptr : it->second.get();
+
+            if (gatherOccluders) {
+              for (int t = 0; t < TILES; ++t) {
+                int h = c ? c->getOccluderHeight(t % Chunk::OCCLUDER_TILES,
+                                                 t / Chunk::OCCLUDER_TILES)
+                          : 0;
+                if (h == 0) {
+                  endRun(t, y * CHUNK_SIZE);
+                  continue;
+                }
+                if (runStart[t] < 0)
+                  runStart[t] = y * CHUNK_SIZE;
+                if (h < CHUNK_SIZE)
+                  endRun(t, y * CHUNK_SIZE + h);
+              }
+            }
 
-            Chunk *c = it->second.get();
+            if (!c)
+              continue;
 
             glm::vec3 min(x * CHUNK_SIZE, y * CHUNK_SIZE, z * CHUNK_SIZE);
             glm::vec3 max = min + glm::vec3(CHUNK_SIZE);
 
             bool visible = isAABBInFrustum(min, max, planes);
 
-            if (c->meshDirty) {
+            // Generated chunks wait for their column's initial lighting
+            bool lit = c->isLightReady() || !c->getColumn();
+            if (c->meshDirty && lit) {
               QueueMeshUpdate(c, visible);
               c->meshDirty = false;
             }
@@ -982,11 +1142,109 @@ int World::render(Shader &shader, const glm::mat4 &viewProjection,
               visibleChunks.push_back(c);
             }
           }
+
+          if (gatherOccluders) {
+            for (int t = 0; t < TILES; ++t)
+              endRun(t, maxY * CHUNK_SIZE);
+          }
+        }
+      }
+    }
+
+    // Rasterise occluders on the culler's worker while we walk the
+    // visibility graph below
+    if (occlusionCulling)
+      occlusionCuller.Begin(viewProjection, cameraPos, std::move(occluders));
+
+    // Cave Culling
+    // BFS from the camera chunk through the visibility graph. A chunk is only
+    // entered through a face that is connected to the face we arrived from,
+    // and we never step back against a direction already taken.
+    lastCaveCulled = 0;
+    int cy = (int)floor(cameraPos.y / CHUNK_SIZE);
+    auto startIt = chunks.find(std::make_tuple(cx, cy, cz));
+    if (caveCulling && startIt != chunks.end()) {
+      PROFILE_SCOPE("Cave Culling");
+
+      struct VisNode {
+        Chunk *chunk;
+        int fromFace; // Face we entered through, -1 for the camera chunk
+        int dirs;     // Bitmask of directions travelled so far
+      };
+      static const int dirOffsets[6][3] = {{0, 0, 1},  {0, 0, -1}, {-1, 0, 0},
+                                           {1, 0, 0},  {0, 1, 0},  {0, -1, 0}};
+
+      std::unordered_set<Chunk *> reachable;
+      reachable.reserve(visibleChunks.size());
+      std::queue<VisNode> bfs;
+
+      reachable.insert(startIt->second.get());
+      bfs.push({startIt->second.get(), -1, 0});
+
+      while (!bfs.empty()) {
+        VisNode node = bfs.front();
+        bfs.pop();
+        const glm::ivec3 &pos = node.chunk->chunkPosition;
+
+        for (int d = 0; d < 6; ++d) {
+          int opposite = d ^ 1; // DIR_* pairs are (0,1), (2,3), (4,5)
+          if (node.dirs & (1 << opposite))
+            continue;
+          if (node.fromFace >= 0 &&
+              !node.chunk->canSeeThrough(node.fromFace, d))
+            continue;
+
+          int nx = pos.x + dirOffsets[d][0];
+          int ny = pos.y + dirOffsets[d][1];
+          int nz = pos.z + dirOffsets[d][2];
+          if (ny < minY || ny >= maxY || std::abs(nx - cx) > renderDist ||
+              std::abs(nz - cz) > renderDist)
+            continue;
+
+          auto it = chunks.find(std::make_tuple(nx, ny, nz));
+          if (it == chunks.end())
+            continue;
+          Chunk *n = it->second.get();
+          if (reachable.count(n))
+            continue;
+
+          glm::vec3 min(nx * CHUNK_SIZE, ny * CHUNK_SIZE, nz * CHUNK_SIZE);
+          if (!isAABBInFrustum(min, min + glm::vec3(CHUNK_SIZE), planes))
+            continue;
+
+          reachable.insert(n);
+          bfs.push({n, opposite, node.dirs | (1 << d)});
         }
       }
+
+      size_t before = visibleChunks.size();
+      visibleChunks.erase(std::remove_if(visibleChunks.begin(),
+                                         visibleChunks.end(),
+                                         [&reachable](Chunk *c) {
+                                           return reachable.count(c) == 0;
+                                         }),
+                          visibleChunks.end());
+      lastCaveCulled = (int)(before - visibleChunks.size());
     }
   }
 
+  // Occlusion Culling
+  lastOcclusionCulled = 0;
+  if (occlusionCulling) {
+    PROFILE_SCOPE("Occlusion Culling");
+    occlusionCuller.Wait();
+    size_t before = visibleChunks.size();
+    visibleChunks.erase(
+        std::remove_if(visibleChunks.begin(), visibleChunks.end(),
+                       [this](Chunk *c) {
+                         glm::vec3 min(c->chunkPosition * CHUNK_SIZE);
+                         return !occlusionCuller.IsVisible(
+                             min, min + glm::vec3(CHUNK_SIZE));
+                       }),
+        visibleChunks.end());
+    lastOcclusionCulled = (int)(before - visibleChunks.size());
+  }
+
   // Render outside lock
   int count = 0;
 
@@ -1010,40 +1268,27 @@ int World::render(Shader &shader, const glm::mat4 &viewProjection,
   }
 
   // Render Opaque
-  // Shader setup...
+  // Chunk meshes live in the shared arena and carry their origin per draw, so
+  // the model matrix is identity for the whole pass.
   shader.use();
-  // Argument name is 'viewProjection'.
-  // We should assume shader needs VP.
-  // Actually shader code likely uses "projection" and "view" separate or "vp"?
-  // Let's rely on main setup or uniform name.
-  // Actually: src/main.cpp passes "cullMatrix" (P*V) as 2nd arg.
-  // Chunk::render just uses it? No, checking Chunk::render...
-  // Chunk::render doesn't use it. It sets "model".
-  // World::render has shader reference.
-  // Wait, looking at World.cpp original code...
-
-  // Original code didn't set "view" or "projection" here?
-  // Ah, lines 926+ in original file might set them?
-  // I replaced loop.
-  // Let's check where I am editing.
+  shader.set(shader.getUniform<glm::mat4>("model"), glm::mat4(1.0f));
 
-  // Render Opaque
+  std::vector<ChunkDraw> draws;
+  draws.reserve(visibleChunks.size());
   {
     PROFILE_SCOPE("Render Opaque");
     for (Chunk *c : visibleChunks) {
       if (c) {
-        c->render(shader, viewProjection, 0); // Opaque
+        c->appendDraw(draws, 0); // Opaque
         count++;
       }
     }
+    meshArena->Draw(draws);
   }
 
   // Pass 2: Transparent
   // SORT Back-to-Front for correct transparency blending
-  // We reuse the list but reverse it?
-  // Actually, we just iterate backwards if we sorted Front-to-Back above.
-  // Or just re-sort/reverse.
-  // Iterating backwards is cheapest.
+  // Iterating backwards over the Front-to-Back list is cheapest.
 
   glEnable(GL_BLEND);
   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -1062,12 +1307,14 @@ int World::render(Shader &shader, const glm::mat4 &viewProjection,
 
   {
     PROFILE_SCOPE("Transp Draw");
+    draws.clear();
     for (auto it = visibleChunks.rbegin(); it != visibleChunks.rend(); ++it) {
       Chunk *c = *it;
       if (c) {
-        c->render(shader, viewProjection, 1); // Transparent
+        c->appendDraw(draws, 1); // Transparent
       }
     }
+    meshArena->Draw(draws);
   }
   glDepthMask(GL_TRUE); // Restore depth write
 
@@ -1156,6 +1403,40 @@ bool World::raycast(glm::vec3 origin, glm::vec3 direction, float maxDist,
 
 size_t World::getChunkCount() const { return chunks.size(); }
 
+WorldPipelineStats World::getPipelineStats() const {
+  auto lockStats = [](const LockContention &c) {
+    WorldPipelineStats::Lock l;
+    l.contended = c.contended.load();
+    l.waitMs = c.waitNanos.load() / 1e6;
+    return l;
+  };
+
+  WorldPipelineStats stats;
+  stats.chunksGenerated = chunksGenerated.load();
+  stats.meshesBuilt = meshesBuilt.load();
+  stats.genMs = genNanos.load() / 1e6;
+  stats.lightMs = lightNanos.load() / 1e6;
+  stats.meshMs = meshNanos.load() / 1e6;
+  stats.worldLock = lockStats(worldLockStats);
+  stats.lightLock = lockStats(lightLockStats);
+  stats.columnLock = lockStats(columnLockStats);
+  stats.genQueueLock = lockStats(genLockStats);
+  stats.meshQueueLock = lockStats(meshLockStats);
+  return stats;
+}
+
+bool World::isPipelineIdle() {
+  // Generation first: a chunk leaves generatingChunks only after its mesh
+  // requests are queued
+  {
+    std::lock_guard<std::mutex> lock(genMutex);
+    if (!genQueue.empty() || !generatingChunks.empty())
+      return false;
+  }
+  std::lock_guard<std::mutex> lock(queueMutex);
+  return meshQueue.empty() && meshQueueHighPrio.empty() && activeMeshJobs == 0;
+}
+
 void World::renderDebugBorders(Shader &shader,
                                const glm::mat4 &viewProjection) {
   static unsigned int borderVAO = 0;
@@ -1208,6 +1489,8 @@ void World::renderDebugBorders(Shader &shader,
       viewProjection); // Need to move extractPlanes to be accessible or copy it
   // It's defined as a static helper in this file? check line 441. Yes.
 
+  UniformHandle<glm::mat4> modelLoc = shader.getUniform<glm::mat4>("model");
+
   std::lock_guard<std::mutex> lock(worldMutex);
   for (auto &pair : chunks) {
     Chunk *c = pair.second.get();
@@ -1220,7 +1503,7 @@ void World::renderDebugBorders(Shader &shader,
       glm::mat4 model = glm::mat4(1.0f);
       model = glm::translate(model, min);
       model = glm::scale(model, glm::vec3(CHUNK_SIZE));
-      shader.setMat4("model", model);
+      shader.set(modelLoc, model);
       glDrawArrays(GL_LINES, 0, 24);
     }
   }
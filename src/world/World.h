@@ -4,23 +4,33 @@
 #include <GL/glew.h>
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <entt/entt.hpp>
 #include <glm/glm.hpp>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <string>
 #include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "../render/ChunkMeshArena.h"
+#include "../render/OcclusionCuller.h"
 #include "../render/Shader.h"
 #include "Block.h"
 #include "Chunk.h"
 #include "ChunkColumn.h"
+#include "ChunkStorage.h"
+#include "LightEngine.h"
 #include "WorldGenConfig.h"
 
+class ColumnCache;
+struct FixedWorldMaps;
+class WorldGenerator;
+
 // Hash function for std::tuple
 // Hash function for std::tuple
 struct key_hash {
@@ -36,6 +46,43 @@ struct key_hash {
   }
 };
 
+// Worker pool sizes (0 = default for the hardware). Headless worlds build
+// meshes but drop them instead of queueing GPU uploads, for benchmarks.
+// Without meshing no mesh is ever queued, so kernel benchmarks can time
+// chunks that no worker touches.
+// Chunks are saved to region files in saveDirectory, and generated column
+// maps are cached in columnCacheDirectory, if those are set.
+struct WorldOptions {
+  int genThreads = 0;
+  int meshThreads = 0;
+  bool headless = false;
+  bool meshing = true;
+  std::string saveDirectory;
+  std::string columnCacheDirectory;
+};
+
+// Contended acquisitions of one lock and the total time spent waiting
+struct LockContention {
+  std::atomic<uint64_t> contended{0};
+  std::atomic<uint64_t> waitNanos{0};
+};
+
+// Cumulative chunk pipeline counters. Busy times are summed over the
+// worker threads of each stage.
+struct WorldPipelineStats {
+  uint64_t chunksGenerated = 0; // Also chunks linked and lit
+  uint64_t meshesBuilt = 0;
+  double genMs = 0.0;   // Column + chunk generation
+  double lightMs = 0.0; // Neighbour linking and initial lighting
+  double meshMs = 0.0;  // generateGeometry
+
+  struct Lock {
+    uint64_t contended = 0;
+    double waitMs = 0.0;
+  };
+  Lock worldLock, lightLock, columnLock, genQueueLock, meshQueueLock;
+};
+
 struct BlockUpdate {
   int x, y, z;
   long long tick; // Execution time
@@ -46,7 +93,8 @@ struct BlockUpdate {
 
 class World {
 public:
-  World(const WorldGenConfig &config);
+  World(const WorldGenConfig &config,
+        const WorldOptions &options = WorldOptions());
   ~World();
 
   void addChunk(int x, int y, int z); // Chunk coords
@@ -74,6 +122,18 @@ public:
   int render(Shader &shader, const glm::mat4 &viewProjection,
              const glm::vec3 &cameraPos, int renderDistance);
 
+  // Cave culling: only draw chunks reachable from the camera chunk through
+  // the per-chunk face visibility graph.
+  bool caveCulling = true;
+  int lastCaveCulled = 0; // Frustum-visible chunks rejected last frame
+
+  // Shared GPU storage for all chunk meshes of this world
+  std::shared_ptr<ChunkMeshArena> getMeshArena() const { return meshArena; }
+
+  // Software occlusion culling against nearby terrain
+  bool occlusionCulling = true;
+  int lastOcclusionCulled = 0;
+
   // Raycast against all chunks (or optimization)
   // Returns true and fills info if hit
   bool raycast(glm::vec3 origin, glm::vec3 direction, float maxDist,
@@ -88,6 +148,11 @@ public:
   void Update(); // Main Thread
   void QueueMeshUpdate(Chunk *c, bool priority = false);
 
+  // Pipeline instrumentation (benchmarks)
+  WorldPipelineStats getPipelineStats() const;
+  // True once nothing is queued or in flight for generation or meshing
+  bool isPipelineIdle();
+
   // Friend for generator if needed, or public method
   // Generator will just use addChunk/getChunk.
 
@@ -97,6 +162,8 @@ private:
       chunks;
   mutable std::mutex worldMutex;
 
+  WorldOptions options;
+
   // Worker Thread
   std::vector<std::thread> meshThreads;
   std::atomic<bool> shutdown;
@@ -108,6 +175,7 @@ private:
   std::deque<std::shared_ptr<Chunk>>
       meshQueueHighPrio;               // High priority (block breaks)
   std::unordered_set<Chunk *> meshSet; // For deduplication across both queues
+  int activeMeshJobs = 0;              // Popped but not yet built
 
   std::mutex uploadMutex;
   std::vector<std::tuple<std::shared_ptr<Chunk>, std::vector<float>, int>>
@@ -129,6 +197,10 @@ private:
   std::mutex genMutex;
   std::condition_variable genCondition;
   std::vector<std::thread> genThreads;
+  // Built once before the gen threads start; null unless fixedWorld
+  std::shared_ptr<const FixedWorldMaps> fixedMaps;
+  // Shared by the generators; null without a columnCacheDirectory
+  std::shared_ptr<ColumnCache> columnCache;
 
   std::priority_queue<GenTask> genQueue;
 
@@ -144,8 +216,50 @@ private:
                      key_hash_pair>
       columns;
   std::mutex columnMutex;
+  // Column regions being generated; guarded by columnMutex
+  std::unordered_set<std::pair<int, int>, key_hash_pair> generatingRegions;
+  std::condition_variable columnCondition;
 
   void GenerationWorkerLoop();
+  // Column (x, z), generating its whole column region if it is missing
+  ChunkColumn *acquireColumn(WorldGenerator &generator, int x, int z);
+
+  // Keep the column's highest-opaque map in step with an edit at (lx,ly,lz)
+  void updateSkyHeight(Chunk *c, int lx, int ly, int lz);
+
+  // While Tick() runs, edits only record what changed; lighting and meshes
+  // for all of them are resolved once when the tick ends (Main thread)
+  bool deferBlockUpdates = false;
+  std::unordered_set<Chunk *> deferredMeshes;
+  void requestEditMesh(Chunk *c, bool priority);
+
+  // Incremental relighting for block edits. Its mutex is taken before
+  // worldMutex/columnMutex and guards every light write and neighbour relink.
+  LightEngine lightEngine{*this};
+
+  // Region file persistence; null when the world is not saved. Generation
+  // workers try a load before generating. Chunks are written when they
+  // unload unless they match their stored copy, and edits are also written
+  // every AUTOSAVE_TICKS and on shutdown.
+  std::unique_ptr<ChunkStorage> storage;
+  static const int AUTOSAVE_TICKS = 600; // 30 s
+  void saveUnsavedChunks();
+
+  // Pipeline counters, see getPipelineStats()
+  std::atomic<uint64_t> chunksGenerated{0};
+  std::atomic<uint64_t> meshesBuilt{0};
+  std::atomic<uint64_t> genNanos{0};
+  std::atomic<uint64_t> lightNanos{0};
+  std::atomic<uint64_t> meshNanos{0};
+  mutable LockContention worldLockStats;
+  LockContention lightLockStats;
+  LockContention columnLockStats;
+  LockContention genLockStats;
+  LockContention meshLockStats;
+
+  OcclusionCuller occlusionCuller;
+  std::shared_ptr<ChunkMeshArena> meshArena =
+      std::make_shared<ChunkMeshArena>();
 
 public:
   void loadChunks(const glm::vec3 &playerPos, int renderDistance,
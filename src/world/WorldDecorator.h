@@ -2,14 +2,21 @@
 #define WORLD_DECORATOR_H
 
 #include "Chunk.h"
+#include <vector>
 
 class WorldGenerator;
+struct ColumnStructure;
 
 class WorldDecorator {
 public:
   virtual ~WorldDecorator() {}
   virtual void Decorate(Chunk &chunk, WorldGenerator &generator,
                         const struct ChunkColumn &column) = 0;
+  // Called once per column, before any of its chunks is decorated, to add
+  // the structures Decorate() will stamp. (cx, cz) are column coordinates.
+  virtual void PlanStructures(WorldGenerator &generator,
+                              const struct ChunkColumn &column, int cx,
+                              int cz, std::vector<ColumnStructure> &out) {}
 };
 
 #endif
@@ -1,5 +1,6 @@
 #include <map>
 #pragma once
+#include <cstdint>
 #include <nlohmann/json.hpp>
 #include <string>
 #include <vector>
@@ -193,3 +194,15 @@ inline void from_json(const json &j, WorldGenConfig &c) {
   j.at("cactusDensity").get_to(c.cactusDensity);
   j.at("floraDensity").get_to(c.floraDensity);
 }
+
+// Stable identity of a configuration (FNV-1a of its JSON form), used to keep
+// the saves of different generator settings apart
+inline uint64_t HashWorldGenConfig(const WorldGenConfig &c) {
+  std::string text = json(c).dump();
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (unsigned char ch : text) {
+    hash ^= ch;
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
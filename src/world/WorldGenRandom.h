@@ -0,0 +1,53 @@
+#ifndef WORLD_GEN_RANDOM_H
+#define WORLD_GEN_RANDOM_H
+
+#include <cstdint>
+
+// Stateless, counter-based randomness for world generation.
+// Every value is a SplitMix64 hash of (seed, position, salt, counter), so it
+// depends only on what is being generated, never on thread scheduling or on
+// the order chunks are built in. Safe to use from any number of threads.
+class WorldGenRandom {
+public:
+  // Salts keep the streams of different features independent
+  static const uint32_t SALT_ORE = 1;
+  static const uint32_t SALT_FLORA = 2;
+  static const uint32_t SALT_TREE = 3;
+
+  // Stream for one feature of one position (usually a chunk origin)
+  WorldGenRandom(int seed, int x, int y, int z, uint32_t salt)
+      : key(Key(seed, x, y, z, salt)) {}
+
+  uint32_t Next() { return (uint32_t)(Mix(key + ++counter * GAMMA) >> 32); }
+  // Uniform in [0, bound)
+  int NextInt(int bound) {
+    return (int)(((uint64_t)Next() * (uint64_t)bound) >> 32);
+  }
+
+  // One-off value for a position, uniform in [0, bound)
+  static int At(int seed, int x, int y, int z, uint32_t salt, int bound) {
+    uint32_t r = (uint32_t)(Mix(Key(seed, x, y, z, salt) + GAMMA) >> 32);
+    return (int)(((uint64_t)r * (uint64_t)bound) >> 32);
+  }
+
+private:
+  static const uint64_t GAMMA = 0x9E3779B97F4A7C15ULL;
+
+  static uint64_t Mix(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+
+  static uint64_t Key(int seed, int x, int y, int z, uint32_t salt) {
+    uint64_t h = Mix((uint64_t)(uint32_t)seed ^ ((uint64_t)salt << 32));
+    h = Mix(h ^ (uint64_t)(uint32_t)x);
+    h = Mix(h ^ (uint64_t)(uint32_t)y);
+    return Mix(h ^ (uint64_t)(uint32_t)z);
+  }
+
+  uint64_t key;
+  uint64_t counter = 0;
+};
+
+#endif
@@ -4,6 +4,7 @@
 #include "Block.h"
 #include "Chunk.h"
 #include "ChunkColumn.h"
+#include "ColumnCache.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/noise.hpp>
 
@@ -11,10 +12,16 @@
 #include "OreDecorator.h"
 #include "TreeDecorator.h"
 #include <FastNoise/FastNoise.h>
+#include <algorithm>
+#include <atomic>
 #include <mutex>
+#include <thread>
 
 WorldGenerator::WorldGenerator(const WorldGenConfig &config)
     : config(config), m_Seed(config.seed) {
+  for (int id = 0; id < 256; ++id)
+    m_BlockTable[id] = BlockRegistry::getInstance().getBlock((uint8_t)id);
+
   if (config.enableOre)
     decorators.push_back(new OreDecorator());
   if (config.enableTrees)
@@ -38,115 +45,6 @@ WorldGenerator::~WorldGenerator() {
   delete caveGenerator;
 }
 
-int WorldGenerator::ComputeHeight(int x, int z) {
-  // Get landform noise for blending
-  float landformNoise = GetLandformNoise(x, z);
-
-  int seedX = (m_Seed * 1337) % 65536;
-  int seedZ = (m_Seed * 9999) % 65536;
-  float nx = (float)x + (float)seedX;
-  float nz = (float)z + (float)seedZ;
-
-  // Enhanced octave system with 10 octaves
-  const int numOctaves = 10;
-  float noiseHeight = 0.0f;
-  float frequency = config.terrainScale;
-
-  // Blend between landforms for smooth transitions
-  LandformConfig *primary = nullptr;
-  LandformConfig *secondary = nullptr;
-  float blendFactor = 0.0f;
-
-  if (landformNoise < -0.4f) {
-    primary = &landforms["oceans"];
-    secondary = &landforms["valleys"];
-    blendFactor = (landformNoise + 0.6f) / 0.2f; // -0.6 to -0.4
-  } else if (landformNoise < 0.0f) {
-    primary = &landforms["valleys"];
-    secondary = &landforms["plains"];
-    blendFactor = (landformNoise + 0.4f) / 0.4f; // -0.4 to 0.0
-  } else if (landformNoise < 0.4f) {
-    primary = &landforms["plains"];
-    secondary = &landforms["hills"];
-    blendFactor = (landformNoise - 0.0f) / 0.4f; // 0.0 to 0.4
-  } else {
-    primary = &landforms["hills"];
-    secondary = &landforms["mountains"];
-    blendFactor = (landformNoise - 0.4f) / 0.4f; // 0.4 to 0.8
-  }
-
-  blendFactor = std::max(0.0f, std::min(1.0f, blendFactor));
-
-  for (int i = 0; i < numOctaves; ++i) {
-    float octaveValue = FastNoise2D(nx * frequency, nz * frequency, i);
-
-    // Blend octave amplitudes between landforms
-    float ampP = (i < primary->octaveAmplitudes.size())
-                     ? primary->octaveAmplitudes[i]
-                     : primary->octaveAmplitudes[i]; // Default to landform base
-    float ampS = (i < secondary->octaveAmplitudes.size())
-                     ? secondary->octaveAmplitudes[i]
-                     : secondary->octaveAmplitudes[i];
-
-    // Check for overrides in config
-    auto itP = config.landformOverrides.find(primary->name);
-    if (itP != config.landformOverrides.end() &&
-        i < itP->second.octaveAmplitudes.size()) {
-      ampP = itP->second.octaveAmplitudes[i];
-    }
-    auto itS = config.landformOverrides.find(secondary->name);
-    if (itS != config.landformOverrides.end() &&
-        i < itS->second.octaveAmplitudes.size()) {
-      ampS = itS->second.octaveAmplitudes[i];
-    }
-
-    float blendedAmplitude = ampP * (1.0f - blendFactor) + ampS * blendFactor;
-
-    float blendedThreshold =
-        primary->octaveThresholds[i] * (1.0f - blendFactor) +
-        secondary->octaveThresholds[i] * blendFactor;
-
-    if (octaveValue > blendedThreshold) {
-      noiseHeight += (octaveValue - blendedThreshold) * blendedAmplitude;
-    }
-
-    frequency *= 2.0f;
-  }
-
-  // Normalize by sum of blended amplitudes
-  float maxPossibleAmplitude = 0.0f;
-  for (int i = 0; i < numOctaves; ++i) {
-    float blendedAmp = primary->octaveAmplitudes[i] * (1.0f - blendFactor) +
-                       secondary->octaveAmplitudes[i] * blendFactor;
-    maxPossibleAmplitude += blendedAmp;
-  }
-  if (maxPossibleAmplitude > 0.0f) {
-    noiseHeight /= maxPossibleAmplitude;
-  }
-
-  // Blend base height and variation
-  float blendedBaseHeight = primary->baseHeight * (1.0f - blendFactor) +
-                            secondary->baseHeight * blendFactor;
-  float blendedVariation = primary->heightVariation * (1.0f - blendFactor) +
-                           secondary->heightVariation * blendFactor;
-
-  int baseFinalHeight =
-      (int)(blendedBaseHeight + noiseHeight * blendedVariation);
-
-  // River Carving
-  if (config.enableRivers) {
-    float carveFactor = GetRiverCarveFactor(x, z);
-    if (carveFactor > 0.0f) {
-      // Ensure it reaches sea level + some channel depth
-      float heightToSea = (float)(baseFinalHeight - config.seaLevel);
-      float dynamicDepth = std::max(config.riverDepth, heightToSea + 2.0f);
-      baseFinalHeight -= (int)(dynamicDepth * carveFactor);
-    }
-  }
-
-  return baseFinalHeight;
-}
-
 float WorldGenerator::GetRiverCarveFactor(int x, int z) {
   if (!config.enableRivers)
     return 0.0f;
@@ -157,6 +55,10 @@ float WorldGenerator::GetRiverCarveFactor(int x, int z) {
 
   float riverNoise =
       FastNoise2D(rx * config.riverScale, rz * config.riverScale, 600);
+  return RiverCarveFromNoise(riverNoise);
+}
+
+float WorldGenerator::RiverCarveFromNoise(float riverNoise) const {
   float riverVal = std::abs(riverNoise);
 
   if (riverVal < config.riverThreshold) {
@@ -166,153 +68,229 @@ float WorldGenerator::GetRiverCarveFactor(int x, int z) {
   return 0.0f;
 }
 
+int WorldGenerator::ApplyRiverCarve(int height, float carveFactor) const {
+  if (carveFactor <= 0.0f)
+    return height;
+  // Ensure it reaches sea level + some channel depth
+  float heightToSea = (float)(height - config.seaLevel);
+  float dynamicDepth = std::max(config.riverDepth, heightToSea + 2.0f);
+  return height - (int)(dynamicDepth * carveFactor);
+}
+
 int WorldGenerator::GetHeightForLandform(const std::string &name, int x,
                                          int z) {
+  int height;
+  GenerateLandformHeightMap(name, &height, x, z, 1, 1);
+  return height;
+}
+
+void WorldGenerator::GenerateLandformHeightMap(const std::string &name,
+                                               int *out, int startX,
+                                               int startZ, int width,
+                                               int depth) const {
+  size_t count = (size_t)width * depth;
   auto it = landforms.find(name);
   if (it == landforms.end()) {
-    return config.seaLevel; // Default if landform not found
+    std::fill(out, out + count, config.seaLevel); // Landform not found
+    return;
   }
+  const LandformConfig &landform = it->second;
 
-  LandformConfig *landform = &it->second;
-
-  int seedOffX = (m_Seed * 1337) % 65536;
-  int seedOffZ = (m_Seed * 9999) % 65536;
-  float nx = (float)x + (float)seedOffX;
-  float nz = (float)z + (float)seedOffZ;
+  if (!m_PerlinNoise2D)
+    const_cast<WorldGenerator *>(this)->InitializeFastNoise();
 
+  // Per-octave shape, with config overrides, resolved once for the batch.
+  // Normalization uses the preset amplitudes.
   const int numOctaves = 10;
-  float noiseHeight = 0.0f;
-  float frequency = config.terrainScale;
-
+  float amps[numOctaves];
+  float thresholds[numOctaves];
+  float maxPossibleAmplitude = 0.0f;
+  auto itOverride = config.landformOverrides.find(name);
   for (int i = 0; i < numOctaves; ++i) {
-    float octaveValue = m_PerlinNoise2D->GenSingle2D(
-        nx * frequency, nz * frequency, m_Seed + i);
-
-    float amp = (i < landform->octaveAmplitudes.size())
-                    ? landform->octaveAmplitudes[i]
-                    : 0.0f;
-
-    // Check for overrides in config
-    auto itOverride = config.landformOverrides.find(name);
+    amps[i] = (i < (int)landform.octaveAmplitudes.size())
+                  ? landform.octaveAmplitudes[i]
+                  : 0.0f;
+    maxPossibleAmplitude += amps[i];
     if (itOverride != config.landformOverrides.end() &&
-        i < itOverride->second.octaveAmplitudes.size()) {
-      amp = itOverride->second.octaveAmplitudes[i];
+        i < (int)itOverride->second.octaveAmplitudes.size()) {
+      amps[i] = itOverride->second.octaveAmplitudes[i];
     }
-
-    float threshold = (i < landform->octaveThresholds.size())
-                          ? landform->octaveThresholds[i]
-                          : 0.0f;
-
-    if (octaveValue > threshold) {
-      noiseHeight += (octaveValue - threshold) * amp;
-    }
-
-    frequency *= 2.0f;
+    thresholds[i] = (i < (int)landform.octaveThresholds.size())
+                        ? landform.octaveThresholds[i]
+                        : 0.0f;
   }
 
-  // Normalize
-  float maxPossibleAmplitude = 0.0f;
+  // Each octave is one SIMD grid, accumulated in place
+  int seedOffX = (m_Seed * 1337) % 65536;
+  int seedOffZ = (m_Seed * 9999) % 65536;
+  std::vector<float> octave(count);
+  std::vector<float> noiseHeight(count, 0.0f);
+  float frequency = config.terrainScale;
   for (int i = 0; i < numOctaves; ++i) {
-    if (i < landform->octaveAmplitudes.size()) {
-      maxPossibleAmplitude += landform->octaveAmplitudes[i];
+    m_PerlinNoise2D->GenUniformGrid2D(octave.data(), startX + seedOffX,
+                                      startZ + seedOffZ, width, depth,
+                                      frequency, m_Seed + i);
+    for (size_t p = 0; p < count; ++p) {
+      if (octave[p] > thresholds[i])
+        noiseHeight[p] += (octave[p] - thresholds[i]) * amps[i];
     }
-  }
-  if (maxPossibleAmplitude > 0.0f) {
-    noiseHeight /= maxPossibleAmplitude;
+    frequency *= 2.0f;
   }
 
-  int finalHeight =
-      (int)(landform->baseHeight + noiseHeight * landform->heightVariation);
-
-  // Apply river carving
+  std::vector<float> riverNoise;
   if (config.enableRivers) {
-    float carveFactor = GetRiverCarveFactor(x, z);
-    if (carveFactor > 0.0f) {
-      float heightToSea = (float)(finalHeight - config.seaLevel);
-      float dynamicDepth = std::max(config.riverDepth, heightToSea + 2.0f);
-      finalHeight -= (int)(dynamicDepth * carveFactor);
-    }
+    riverNoise.resize(count);
+    GenerateRiverGrid(riverNoise.data(), startX, startZ, width, depth);
   }
 
-  return finalHeight;
+  for (size_t p = 0; p < count; ++p) {
+    float h = noiseHeight[p];
+    if (maxPossibleAmplitude > 0.0f)
+      h /= maxPossibleAmplitude;
+    int finalHeight = (int)(landform.baseHeight + h * landform.heightVariation);
+    if (!riverNoise.empty())
+      finalHeight =
+          ApplyRiverCarve(finalHeight, RiverCarveFromNoise(riverNoise[p]));
+    out[p] = finalHeight;
+  }
 }
 
-// Ensure GenerateFixedMaps is defined
 void WorldGenerator::GenerateFixedMaps() {
-  if (!config.fixedWorld)
-    return;
+  m_FixedMaps = BuildFixedMaps(config);
+}
+
+std::shared_ptr<const FixedWorldMaps>
+WorldGenerator::BuildFixedMaps(const WorldGenConfig &config, int threadCount) {
+  if (!config.fixedWorld || config.fixedWorldSize <= 0)
+    return nullptr;
+  PROFILE_SCOPE("BuildFixedMaps");
 
+  auto maps = std::make_shared<FixedWorldMaps>();
   int size = config.fixedWorldSize;
-  fixedHeightMap.resize(size * size);
-  fixedTempMap.resize(size * size);
-  fixedHumidMap.resize(size * size);
-  fixedBiomeMap.resize(size * size);
-
-  int halfSize = size / 2;
-  for (int z = 0; z < size; ++z) {
-    for (int x = 0; x < size; ++x) {
-      int idx = x + z * size;
-      // Convert index to world coordinates (centered)
-      int worldX = x - halfSize;
-      int worldZ = z - halfSize;
-
-      fixedHeightMap[idx] = ComputeHeight(worldX, worldZ);
-      fixedTempMap[idx] = ComputeTemperature(worldX, worldZ, -1);
-      fixedHumidMap[idx] = ComputeHumidity(worldX, worldZ);
-      fixedBiomeMap[idx] = ComputeBiome(worldX, worldZ, -1);
+  maps->size = size;
+  maps->heightMap.resize((size_t)size * size);
+  maps->tempMap.resize((size_t)size * size);
+  maps->humidMap.resize((size_t)size * size);
+  maps->biomeMap.resize((size_t)size * size);
+
+  // Tiles are independent, so workers just pull the next index. Each worker
+  // has its own generator; the result is identical for any thread count.
+  const int TILE = 64;
+  int tilesPerSide = (size + TILE - 1) / TILE;
+  int tileCount = tilesPerSide * tilesPerSide;
+  if (threadCount <= 0)
+    threadCount = (int)std::max(1u, std::thread::hardware_concurrency());
+  threadCount = std::min(threadCount, tileCount);
+
+  std::atomic<int> nextTile{0};
+  auto worker = [&]() {
+    WorldGenerator generator(config);
+    int t;
+    while ((t = nextTile.fetch_add(1)) < tileCount) {
+      generator.FillFixedMapTile(*maps, (t % tilesPerSide) * TILE,
+                                 (t / tilesPerSide) * TILE, TILE);
     }
-  }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 1; i < threadCount; ++i)
+    threads.emplace_back(worker);
+  worker();
+  for (auto &t : threads)
+    t.join();
+
+  LOG_WORLD_INFO("Fixed world maps built: {}x{} on {} threads", size, size,
+                 threadCount);
+  return maps;
 }
 
-int WorldGenerator::GetHeight(int gx, int gz) {
+void WorldGenerator::FillFixedMapTile(FixedWorldMaps &maps, int tileX,
+                                      int tileZ, int tileSize) {
   if (!m_HeightFractal)
     InitializeFastNoise();
 
-  float lNoise = GetLandformNoise(gx, gz);
-  float nx = (float)gx * config.terrainScale;
-  float nz = (float)gz * config.terrainScale;
-  float hNoise = m_HeightFractal->GenSingle2D(nx, nz, m_Seed);
-
-  int baseFinalHeight = CalculateHeightFromNoise(hNoise, lNoise);
+  int size = maps.size;
+  int width = std::min(tileSize, size - tileX);
+  int depth = std::min(tileSize, size - tileZ);
+  // Map index -> world coordinates (centered)
+  int startX = tileX - size / 2;
+  int startZ = tileZ - size / 2;
+
+  size_t count = (size_t)width * depth;
+  std::vector<int> heights(count);
+  std::vector<float> tempNoise(count), humidNoise(count);
+  GenerateHeightMap(heights.data(), startX, startZ, width, depth);
+  GenerateTemperatureGrid(tempNoise.data(), startX, startZ, width, depth);
+  GenerateHumidityGrid(humidNoise.data(), startX, startZ, width, depth);
+
+  // Biome variation layers, same sampling as ComputeBiome
+  std::vector<float> var1, var2;
+  if (config.biomeVariation > 0.0f) {
+    int seedV = (m_Seed * 5555) % 65536;
+    var1.resize(count);
+    var2.resize(count);
+    m_PerlinNoise2D->GenUniformGrid2D(var1.data(), (float)startX + seedV,
+                                      (float)startZ + seedV, width, depth,
+                                      0.05f, m_Seed + 1);
+    m_PerlinNoise2D->GenUniformGrid2D(var2.data(), (float)startX + seedV,
+                                      (float)startZ + seedV, width, depth,
+                                      1.3f * 0.08f, m_Seed + 2);
+  }
 
-  // River Carving
-  if (config.enableRivers) {
-    float carveFactor = GetRiverCarveFactor(gx, gz);
-    if (carveFactor > 0.0f) {
-      // Ensure it reaches sea level + some channel depth
-      float heightToSea = (float)(baseFinalHeight - config.seaLevel);
-      float dynamicDepth = std::max(config.riverDepth, heightToSea + 2.0f);
-      baseFinalHeight -= (int)(dynamicDepth * carveFactor);
+  for (int z = 0; z < depth; ++z) {
+    for (int x = 0; x < width; ++x) {
+      int i = x + z * width;
+      size_t idx = (size_t)(tileX + x) + (size_t)(tileZ + z) * size;
+
+      int height = heights[i];
+      float temp = tempNoise[i];
+      float humid = humidNoise[i];
+      maps.heightMap[idx] = height;
+      maps.tempMap[idx] = temp;
+      maps.humidMap[idx] = humid;
+
+      if (!var1.empty()) {
+        float combined = (var1[i] + var2[i] * 0.5f) / 1.5f;
+        temp += combined * config.biomeVariation * 2.0f;
+        humid += combined * config.biomeVariation * 1.6f;
+      }
+      maps.biomeMap[idx] = ClassifyBiome(temp, humid);
     }
   }
+}
 
-  return baseFinalHeight;
+// Landforms in the order they blend along the landform noise
+static const char *const LANDFORM_ORDER[5] = {"oceans", "valleys", "plains",
+                                              "hills", "mountains"};
+
+static void ResolveLandformOrder(const WorldGenConfig &config,
+                                 const LandformConfigOverride *out[5]) {
+  for (int i = 0; i < 5; ++i)
+    out[i] = &config.landformOverrides.at(LANDFORM_ORDER[i]);
 }
 
-int WorldGenerator::CalculateHeightFromNoise(float hNoise, float lNoise) const {
-  std::string primary_name, secondary_name;
+// Height from the terrain and landform noise, given the resolved landforms
+static int BlendLandformHeight(const LandformConfigOverride *const order[5],
+                               float hNoise, float lNoise) {
+  int band;
   float blendFactor;
   if (lNoise < -0.4f) {
-    primary_name = "oceans";
-    secondary_name = "valleys";
+    band = 0;
     blendFactor = (lNoise + 0.6f) / 0.2f;
   } else if (lNoise < 0.0f) {
-    primary_name = "valleys";
-    secondary_name = "plains";
+    band = 1;
     blendFactor = (lNoise + 0.4f) / 0.4f;
   } else if (lNoise < 0.4f) {
-    primary_name = "plains";
-    secondary_name = "hills";
+    band = 2;
     blendFactor = (lNoise - 0.0f) / 0.4f;
   } else {
-    primary_name = "hills";
-    secondary_name = "mountains";
+    band = 3;
     blendFactor = (lNoise - 0.4f) / 0.4f;
   }
   blendFactor = std::max(0.0f, std::min(1.0f, blendFactor));
 
-  const auto &pConfig = config.landformOverrides.at(primary_name);
-  const auto &sConfig = config.landformOverrides.at(secondary_name);
+  const LandformConfigOverride &pConfig = *order[band];
+  const LandformConfigOverride &sConfig = *order[band + 1];
 
   // Apply terrain smoothing
   float smoothedH = (hNoise + 1.0f) * 0.5f;
@@ -323,6 +301,50 @@ int WorldGenerator::CalculateHeightFromNoise(float hNoise, float lNoise) const {
   return (int)(h1 * (1.0f - blendFactor) + h2 * blendFactor);
 }
 
+int WorldGenerator::CalculateHeightFromNoise(float hNoise, float lNoise) const {
+  const LandformConfigOverride *order[5];
+  ResolveLandformOrder(config, order);
+  return BlendLandformHeight(order, hNoise, lNoise);
+}
+
+void WorldGenerator::GenerateHeightMap(int *out, int startX, int startZ,
+                                       int width, int depth) const {
+  size_t count = (size_t)width * depth;
+  std::vector<float> heightNoise(count), landformNoise(count), riverNoise;
+  GenerateHeightGrid(heightNoise.data(), startX, startZ, width, depth);
+  GenerateLandformGrid(landformNoise.data(), startX, startZ, width, depth);
+  if (config.enableRivers) {
+    riverNoise.resize(count);
+    GenerateRiverGrid(riverNoise.data(), startX, startZ, width, depth);
+  }
+
+  // Landform lookups are hoisted out of the per-point loop
+  const LandformConfigOverride *order[5];
+  ResolveLandformOrder(config, order);
+  for (size_t i = 0; i < count; ++i) {
+    int height = BlendLandformHeight(order, heightNoise[i], landformNoise[i]);
+    if (!riverNoise.empty())
+      height = ApplyRiverCarve(height, RiverCarveFromNoise(riverNoise[i]));
+    out[i] = height;
+  }
+}
+
+int WorldGenerator::GetHeight(int gx, int gz) {
+  // GenerateHeightMap for one point, without its heap buffers
+  float heightNoise, landformNoise;
+  GenerateHeightGrid(&heightNoise, gx, gz, 1, 1);
+  GenerateLandformGrid(&landformNoise, gx, gz, 1, 1);
+  const LandformConfigOverride *order[5];
+  ResolveLandformOrder(config, order);
+  int height = BlendLandformHeight(order, heightNoise, landformNoise);
+  if (config.enableRivers) {
+    float riverNoise;
+    GenerateRiverGrid(&riverNoise, gx, gz, 1, 1);
+    height = ApplyRiverCarve(height, RiverCarveFromNoise(riverNoise));
+  }
+  return height;
+}
+
 void WorldGenerator::GetLandformBlend(int x, int z, std::string &primary,
                                       std::string &secondary,
                                       float &blendFactor) {
@@ -375,14 +397,13 @@ float WorldGenerator::ComputeTemperature(int x, int z, int y) {
 }
 
 float WorldGenerator::GetTemperature(int x, int z, int y) {
-  if (config.fixedWorld && !fixedTempMap.empty()) {
-    int halfSize = config.fixedWorldSize / 2;
-    int idxX = x + halfSize;
-    int idxZ = z + halfSize;
-
-    if (idxX >= 0 && idxX < config.fixedWorldSize && idxZ >= 0 &&
-        idxZ < config.fixedWorldSize) {
-      float temp = fixedTempMap[idxX + idxZ * config.fixedWorldSize];
+  if (m_FixedMaps) {
+    int size = m_FixedMaps->size;
+    int idxX = x + size / 2;
+    int idxZ = z + size / 2;
+
+    if (idxX >= 0 && idxX < size && idxZ >= 0 && idxZ < size) {
+      float temp = m_FixedMaps->tempMap[idxX + idxZ * size];
       // Still need to apply lapse rate dynamically because y changes
       if (y != -1 && config.temperatureLapseRate > 0.0f &&
           y > config.seaLevel) {
@@ -412,14 +433,13 @@ float WorldGenerator::ComputeHumidity(int x, int z) {
 }
 
 float WorldGenerator::GetHumidity(int x, int z) {
-  if (config.fixedWorld && !fixedHumidMap.empty()) {
-    int halfSize = config.fixedWorldSize / 2;
-    int idxX = x + halfSize;
-    int idxZ = z + halfSize;
-
-    if (idxX >= 0 && idxX < config.fixedWorldSize && idxZ >= 0 &&
-        idxZ < config.fixedWorldSize) {
-      return fixedHumidMap[idxX + idxZ * config.fixedWorldSize];
+  if (m_FixedMaps) {
+    int size = m_FixedMaps->size;
+    int idxX = x + size / 2;
+    int idxZ = z + size / 2;
+
+    if (idxX >= 0 && idxX < size && idxZ >= 0 && idxZ < size) {
+      return m_FixedMaps->humidMap[idxX + idxZ * size];
     }
     return 0.5f;
   }
@@ -427,16 +447,15 @@ float WorldGenerator::GetHumidity(int x, int z) {
 }
 
 Biome WorldGenerator::GetBiome(int x, int z, int y) {
-  if (config.fixedWorld && !fixedTempMap.empty() && !fixedHumidMap.empty()) {
-    int halfSize = config.fixedWorldSize / 2;
-    int idxX = x + halfSize;
-    int idxZ = z + halfSize;
+  if (m_FixedMaps) {
+    int size = m_FixedMaps->size;
+    int idxX = x + size / 2;
+    int idxZ = z + size / 2;
 
-    if (idxX >= 0 && idxX < config.fixedWorldSize && idxZ >= 0 &&
-        idxZ < config.fixedWorldSize) {
+    if (idxX >= 0 && idxX < size && idxZ >= 0 && idxZ < size) {
       // Fetch cached data
-      float temp = fixedTempMap[idxX + idxZ * config.fixedWorldSize];
-      float humidity = fixedHumidMap[idxX + idxZ * config.fixedWorldSize];
+      float temp = m_FixedMaps->tempMap[idxX + idxZ * size];
+      float humidity = m_FixedMaps->humidMap[idxX + idxZ * size];
 
       // Apply lapse rate again (logic duplicated from GetTemp)
       if (y != -1 && config.temperatureLapseRate > 0.0f &&
@@ -445,17 +464,7 @@ Biome WorldGenerator::GetBiome(int x, int z, int y) {
         temp -= altitudeAboveSeaLevel * config.temperatureLapseRate;
       }
 
-      // Normalize logic (same as ComputeBiome)
-      if (temp > 0.3f) {
-        if (humidity < -0.2f)
-          return BIOME_DESERT;
-        return BIOME_FOREST;
-      } else if (temp < -0.3f) {
-        return BIOME_TUNDRA;
-      }
-      if (humidity < -0.3f)
-        return BIOME_PLAINS;
-      return BIOME_FOREST;
+      return ClassifyBiome(temp, humidity);
     }
     return BIOME_OCEAN;
   }
@@ -495,6 +504,10 @@ Biome WorldGenerator::ComputeBiome(int x, int z, int y, float preTemp,
     humidity += combinedNoise * config.biomeVariation * 1.6f;
   }
 
+  return ClassifyBiome(temperature, humidity);
+}
+
+Biome WorldGenerator::ClassifyBiome(float temperature, float humidity) {
   // Normalize logic slightly if needed, but perlin is approx -1 to 1
 
   if (temperature > 0.3f) {
@@ -622,40 +635,7 @@ BlockType WorldGenerator::GetSurfaceBlock(int gx, int gy, int gz, int height,
     else
       type = subsurfaceBlock;
   } else {
-    // Determine strata using pre-computed values if available
-    float layerWave = 0.0f;
-    float typeNoise = 0.0f;
-
-    if (column) {
-      layerWave = column->strataWaveMap[gx % CHUNK_SIZE][gz % CHUNK_SIZE];
-      typeNoise = column->strataTypeMap[gx % CHUNK_SIZE][gz % CHUNK_SIZE];
-    } else {
-      int seedS = (m_Seed * 777) % 65536;
-      layerWave = m_PerlinNoise2D->GenSingle2D((float)gx + seedS,
-                                               (float)gz + seedS, m_Seed + 300);
-      typeNoise = m_PerlinNoise2D->GenSingle2D((float)gx + seedS,
-                                               (float)gz + seedS, m_Seed + 400);
-    }
-
-    int adjustedY = gy + (int)(layerWave * 5.0f);
-
-    if (adjustedY < 12) {
-      if (typeNoise > 0.3f)
-        type = GRANITE;
-      else if (typeNoise < -0.3f)
-        type = BASALT;
-      else
-        type = DIORITE;
-    } else if (adjustedY < 20) {
-      type = STONE;
-    } else if (adjustedY < 25) {
-      if (typeNoise > 0.2f)
-        type = ANDESITE;
-      else
-        type = TUFF;
-    } else {
-      type = STONE;
-    }
+    type = GetStrataBlock(gx, gy, gz, column);
   }
 
   // Cave/Ravine Carving Check
@@ -699,8 +679,12 @@ BlockType WorldGenerator::GetSurfaceBlock(int gx, int gy, int gz, int height,
 bool WorldGenerator::IsCaveAt(int x, int y, int z) {
   if (!config.enableCaves && !config.enableRavines)
     return false;
+  return IsCaveAt(x, y, z, GetHeight(x, z));
+}
 
-  int surfaceHeight = GetHeight(x, z);
+bool WorldGenerator::IsCaveAt(int x, int y, int z, int surfaceHeight) {
+  if (!config.enableCaves && !config.enableRavines)
+    return false;
   if (y > surfaceHeight)
     return false;
 
@@ -841,320 +825,227 @@ void WorldGenerator::InitializeLandforms() {
   landforms["valleys"] = valleys;
 }
 
-BlockType WorldGenerator::GetStrataBlock(int x, int y, int z) {
-  // Stylized stone layers
-  // Primary: Stone, with horizontal layers of variants for visual interest
-
-  int seedS = (m_Seed * 777) % 65536;
-  float nx = (float)x + (float)seedS;
-  float ny = (float)y;
-  float nz = (float)z + (float)seedS;
-
-  // 2D noise for layer undulation (wavy boundaries)
-  if (!m_PerlinNoise2D)
-    InitializeFastNoise();
+void WorldGenerator::ClassifyStrata(float layerWave, float typeNoise,
+                                    int &shift, BlockType &deep,
+                                    BlockType &mid) {
+  shift = (int)(layerWave * 5.0f);
+  if (typeNoise > 0.3f)
+    deep = GRANITE;
+  else if (typeNoise < -0.3f)
+    deep = BASALT;
+  else
+    deep = DIORITE;
+  mid = (typeNoise > 0.2f) ? ANDESITE : TUFF;
+}
 
-  float layerWave =
-      m_PerlinNoise2D->GenSingle2D(nx * 0.02f, nz * 0.02f, m_Seed + 300);
-  int adjustedY = y + (int)(layerWave * 5.0f);
-
-  // Secondary noise for layer type variation
-  float typeNoise =
-      m_PerlinNoise2D->GenSingle2D(nx * 0.01f, nz * 0.01f, m_Seed + 400);
-
-  // Horizontal layers with some variation
-  // Deep layers
-  if (adjustedY < 12) {
-    if (typeNoise > 0.3f)
-      return GRANITE;
-    else if (typeNoise < -0.3f)
-      return BASALT;
-    else
-      return DIORITE;
-  }
-  // Stone layer
-  else if (adjustedY < 20) {
-    return STONE;
-  }
-  // Mid variant layer
-  else if (adjustedY < 25) {
-    if (typeNoise > 0.2f)
-      return ANDESITE;
-    else
-      return TUFF;
-  }
-  // Stone layer
-  else if (adjustedY < 35) {
-    return STONE;
-  }
-  // Upper variant layer
-  else if (adjustedY < 40) {
-    if (typeNoise > 0.0f)
-      return SANDSTONE;
-    else
-      return DIORITE;
-  }
-  // Stone layer (most common near surface)
-  else {
-    return STONE;
+BlockType WorldGenerator::GetStrataBlock(int gx, int gy, int gz,
+                                         const ChunkColumn *column) {
+  int shift;
+  BlockType deep, mid;
+  if (column) {
+    int lx = gx & (CHUNK_SIZE - 1);
+    int lz = gz & (CHUNK_SIZE - 1);
+    shift = column->strataShift[lx][lz];
+    deep = (BlockType)column->strataDeep[lx][lz];
+    mid = (BlockType)column->strataMid[lx][lz];
+  } else {
+    // Same samples as the GenerateColumn grids
+    if (!m_PerlinNoise2D)
+      InitializeFastNoise();
+    int seedS = (m_Seed * 777) % 65536;
+    float nx = (float)gx + (float)seedS;
+    float nz = (float)gz + (float)seedS;
+    float layerWave =
+        m_PerlinNoise2D->GenSingle2D(nx * 0.02f, nz * 0.02f, m_Seed + 300);
+    float typeNoise =
+        m_PerlinNoise2D->GenSingle2D(nx * 0.01f, nz * 0.01f, m_Seed + 400);
+    ClassifyStrata(layerWave, typeNoise, shift, deep, mid);
   }
+
+  // Horizontal layers, undulating with the column's shift
+  int adjustedY = gy + shift;
+  if (adjustedY < 12)
+    return deep;
+  if (adjustedY >= 20 && adjustedY < 25)
+    return mid;
+  return STONE;
 }
 
 #include "ChunkColumn.h"
 
 void WorldGenerator::GenerateColumn(ChunkColumn &column, int cx, int cz) {
+  ChunkColumn *target = &column;
+  GenerateColumns(&target, cx, cz, 1);
+}
+
+void WorldGenerator::GenerateColumns(ChunkColumn *const *columns, int cx,
+                                     int cz, int regionSize) {
+  PROFILE_SCOPE_CONDITIONAL("GenColumn", m_ProfilingEnabled);
+
+  // Cached columns are copied; the noise stage only runs for the rest
+  std::vector<ChunkColumn *> pending(columns,
+                                     columns + regionSize * regionSize);
+  if (m_ColumnCache) {
+    bool missing = false;
+    for (int c = 0; c < regionSize * regionSize; ++c) {
+      if (pending[c] &&
+          m_ColumnCache->Load(cx + c % regionSize, cz + c / regionSize,
+                              *pending[c]))
+        pending[c] = nullptr;
+      missing |= pending[c] != nullptr;
+    }
+    if (!missing)
+      return;
+  }
+
   if (!m_HeightFractal)
     InitializeFastNoise();
-  PROFILE_SCOPE_CONDITIONAL("GenColumn", m_ProfilingEnabled);
 
+  // Every map is generated once for the whole region, so FastNoise's
+  // per-call setup is paid per region instead of per column
+  const int W = regionSize * CHUNK_SIZE;
+  const size_t count = (size_t)W * W;
   int startX = cx * CHUNK_SIZE;
   int startZ = cz * CHUNK_SIZE;
 
-  // 1. Batch generate Height Map (use vector for alignment)
-  std::vector<float> heightNoise(CHUNK_SIZE * CHUNK_SIZE);
-  m_HeightFractal->GenUniformGrid2D(heightNoise.data(), startX, startZ,
-                                    CHUNK_SIZE, CHUNK_SIZE, config.terrainScale,
-                                    m_Seed);
+  // 1. Batch generate Height Map (landform blend + river carving)
+  std::vector<int> heightMap(count);
+  GenerateHeightMap(heightMap.data(), startX, startZ, W, W);
 
   // 2. Batch generate Temperature Map
-  std::vector<float> tempNoise(CHUNK_SIZE * CHUNK_SIZE);
+  std::vector<float> tempNoise(count);
   int seedT = (m_Seed * 555) % 65536;
   m_TemperatureNoise->GenUniformGrid2D(
-      tempNoise.data(), (float)startX + seedT, (float)startZ + seedT,
-      CHUNK_SIZE, CHUNK_SIZE, config.tempScale, m_Seed + 100);
+      tempNoise.data(), (float)startX + seedT, (float)startZ + seedT, W, W,
+      config.tempScale, m_Seed + 100);
 
   // 3. Batch generate Humidity Map
-  std::vector<float> humidNoise(CHUNK_SIZE * CHUNK_SIZE);
+  std::vector<float> humidNoise(count);
   int seedH = (m_Seed * 888) % 65536;
   m_HumidityNoise->GenUniformGrid2D(
-      humidNoise.data(), (float)startX + seedH, (float)startZ + seedH,
-      CHUNK_SIZE, CHUNK_SIZE, config.humidityScale, m_Seed + 200);
+      humidNoise.data(), (float)startX + seedH, (float)startZ + seedH, W, W,
+      config.humidityScale, m_Seed + 200);
 
   // 4. Batch generate Beach Noise Map
-  std::vector<float> beachNoise(CHUNK_SIZE * CHUNK_SIZE);
+  std::vector<float> beachNoise(count);
   int seedBX = (m_Seed * 5432) % 65536;
   int seedBZ = (m_Seed * 1234) % 65536;
   m_BeachNoise->GenUniformGrid2D(beachNoise.data(), (float)startX + seedBX,
-                                 (float)startZ + seedBZ, CHUNK_SIZE, CHUNK_SIZE,
-                                 0.05f, m_Seed);
+                                 (float)startZ + seedBZ, W, W, 0.05f, m_Seed);
 
-  // 5. Batch generate Landform Noise Map
-  std::vector<float> landformNoise(CHUNK_SIZE * CHUNK_SIZE);
-  int seedL = (m_Seed * 1111) % 65536;
-  m_LandformNoise->GenUniformGrid2D(
-      landformNoise.data(), (float)startX + seedL, (float)startZ + seedL,
-      CHUNK_SIZE, CHUNK_SIZE, config.landformScale, m_Seed + 500);
-
-  // 6. Batch generate Strata Noise Maps
-  std::vector<float> strataWave(CHUNK_SIZE * CHUNK_SIZE);
+  // 5. Batch generate Strata Noise Maps
+  std::vector<float> strataWave(count);
   int seedS = (m_Seed * 777) % 65536;
   m_PerlinNoise2D->GenUniformGrid2D(strataWave.data(), (float)startX + seedS,
-                                    (float)startZ + seedS, CHUNK_SIZE,
-                                    CHUNK_SIZE, 0.02f, m_Seed + 300);
+                                    (float)startZ + seedS, W, W, 0.02f,
+                                    m_Seed + 300);
 
-  std::vector<float> strataType(CHUNK_SIZE * CHUNK_SIZE);
+  std::vector<float> strataType(count);
   m_PerlinNoise2D->GenUniformGrid2D(strataType.data(), (float)startX + seedS,
-                                    (float)startZ + seedS, CHUNK_SIZE,
-                                    CHUNK_SIZE, 0.01f, m_Seed + 400);
-
-  // Process and store in column
-  for (int z = 0; z < CHUNK_SIZE; ++z) {
-    for (int x = 0; x < CHUNK_SIZE; ++x) {
-      int idx = x + z * CHUNK_SIZE;
-
-      // Determine height with landform variety
-      float lNoise = landformNoise[idx];
-      float hNoise = heightNoise[idx];
-      int height = CalculateHeightFromNoise(hNoise, lNoise);
-
-      // Apply River Carving (individual check for now, but could be batched)
-      if (config.enableRivers) {
-        float carve = GetRiverCarveFactor(startX + x, startZ + z);
-        if (carve > 0.0f) {
-          float hToSea = (float)(height - config.seaLevel);
-          height -= (int)(std::max(config.riverDepth, hToSea + 2.0f) * carve);
-        }
+                                    (float)startZ + seedS, W, W, 0.01f,
+                                    m_Seed + 400);
+
+  // Split the region into its columns
+  for (int c = 0; c < regionSize * regionSize; ++c) {
+    ChunkColumn *column = pending[c];
+    if (!column)
+      continue;
+    int offsetX = (c % regionSize) * CHUNK_SIZE;
+    int offsetZ = (c / regionSize) * CHUNK_SIZE;
+
+    for (int z = 0; z < CHUNK_SIZE; ++z) {
+      for (int x = 0; x < CHUNK_SIZE; ++x) {
+        size_t idx = (size_t)(offsetX + x) + (size_t)(offsetZ + z) * W;
+        int gx = startX + offsetX + x;
+        int gz = startZ + offsetZ + z;
+
+        int height = heightMap[idx];
+        column->heightMap[x][z] = height;
+        column->setSkyHeight(x, z, height);
+        column->temperatureMap[x][z] = tempNoise[idx];
+        column->humidityMap[x][z] = humidNoise[idx];
+        column->beachNoiseMap[x][z] = beachNoise[idx];
+        int shift;
+        BlockType deep, mid;
+        ClassifyStrata(strataWave[idx], strataType[idx], shift, deep, mid);
+        column->strataShift[x][z] = (int8_t)shift;
+        column->strataDeep[x][z] = (uint8_t)deep;
+        column->strataMid[x][z] = (uint8_t)mid;
+        column->biomeMap[x][z] = GetBiomeAtHeight(
+            gx, gz, height, tempNoise[idx], humidNoise[idx]);
       }
-
-      column.heightMap[x][z] = height;
-      column.temperatureMap[x][z] = tempNoise[idx];
-      column.humidityMap[x][z] = humidNoise[idx];
-      column.beachNoiseMap[x][z] = beachNoise[idx];
-      column.strataWaveMap[x][z] = strataWave[idx];
-      column.strataTypeMap[x][z] = strataType[idx];
-      column.biomeMap[x][z] = GetBiomeAtHeight(startX + x, startZ + z, height,
-                                               tempNoise[idx], humidNoise[idx]);
     }
+    if (m_ColumnCache)
+      m_ColumnCache->Store(cx + c % regionSize, cz + c / regionSize, *column);
   }
 }
 
 void WorldGenerator::GenerateChunk(Chunk &chunk, const ChunkColumn &column) {
   PROFILE_SCOPE_CONDITIONAL("GenChunk", m_ProfilingEnabled);
   glm::ivec3 pos = chunk.chunkPosition;
+  int baseY = pos.y * CHUNK_SIZE;
+
+  // Nothing but air above the highest terrain/sea voxel of the column. The
+  // chunk starts out as air, so such chunks only need decorating.
+  int maxHeight = column.heightMap[0][0];
+  for (int x = 0; x < CHUNK_SIZE; ++x)
+    for (int z = 0; z < CHUNK_SIZE; ++z)
+      maxHeight = std::max(maxHeight, column.heightMap[x][z]);
+  bool hasTerrain = baseY <= std::max(maxHeight, config.seaLevel);
+
+  // Cave noise is only needed if some voxel of the chunk can be carved:
+  // natural terrain between y = 1 and the carving ceiling
+  bool canCarve = baseY <= std::min(maxHeight, CHUNK_SIZE * 8) &&
+                  baseY + CHUNK_SIZE > 1;
+  const CaveNoiseData *caveNoise = nullptr;
+  if (canCarve && (config.enableCaves || config.enableRavines)) {
+    PROFILE_SCOPE_CONDITIONAL("GenChunk_Caves", m_ProfilingEnabled);
+    // Allocated on HEAP to prevent stack overflow, then reused
+    if (!m_CaveNoise)
+      m_CaveNoise = std::make_unique<CaveNoiseData>();
+    GenerateCaveNoiseData(*m_CaveNoise, pos.x, pos.z, pos.y);
+    caveNoise = m_CaveNoise.get();
+  }
 
-  // Pass 1: Terrain
-  {
+  // Single pass per column: spans are filled in bulk, then carved, and the
+  // result is written straight into the block array. The chunk is not
+  // visible to any other thread yet, so this needs neither chunkMutex nor
+  // registry lookups.
+  if (hasTerrain) {
     PROFILE_SCOPE_CONDITIONAL("GenChunk_Terrain", m_ProfilingEnabled);
+    BlockType types[CHUNK_SIZE];
     for (int x = 0; x < CHUNK_SIZE; ++x) {
       for (int z = 0; z < CHUNK_SIZE; ++z) {
         // Global Coordinates
         int gx = pos.x * CHUNK_SIZE + x;
         int gz = pos.z * CHUNK_SIZE + z;
-
         int height = column.heightMap[x][z];
-        float baseTemp = column.temperatureMap[x][z];
-        float humid = column.humidityMap[x][z];
-        float beachNoise = column.beachNoiseMap[x][z];
-
-        for (int y = 0; y < CHUNK_SIZE; ++y) {
-          int gy = pos.y * CHUNK_SIZE + y;
-          BlockType type = GetSurfaceBlock(gx, gy, gz, height, baseTemp, humid,
-                                           beachNoise, &column);
-          chunk.setBlock(x, y, z, type);
-        }
-      }
-    }
-  }
 
-  // Pass 2: Water & Ice
-  {
-    PROFILE_SCOPE_CONDITIONAL("GenChunk_Water", m_ProfilingEnabled);
-    for (int x = 0; x < CHUNK_SIZE; ++x) {
-      for (int z = 0; z < CHUNK_SIZE; ++z) {
-        int gx = pos.x * CHUNK_SIZE + x;
-        int gz = pos.z * CHUNK_SIZE + z;
+        int end = FillColumnSpans(types, column, x, z, gx, gz, baseY);
+        if (end == 0)
+          continue;
 
-        for (int y = 0; y < CHUNK_SIZE; ++y) {
-          int gy = pos.y * CHUNK_SIZE + y;
-          if (chunk.getBlock(x, y, z).getType() == AIR &&
-              gy <= config.seaLevel) {
-            float temp = column.temperatureMap[x][z];
-            // Apply lapse rate for Ice check at sea level
-            if (gy > config.seaLevel) {
-              float alt = (float)(gy - config.seaLevel);
-              temp -= alt * config.temperatureLapseRate;
-            }
-
-            if (temp < -0.3f && gy == config.seaLevel)
-              chunk.setBlock(x, y, z, ICE);
-            else
-              chunk.setBlock(x, y, z, WATER);
-          }
-        }
-      }
-    }
-  }
-
-  // Pass 3: Caves & Ravines
-  {
-    // LOG_WORLD_INFO("GenChunk Caves Start: {}, {}, {}", pos.x, pos.y, pos.z);
-    PROFILE_SCOPE_CONDITIONAL("GenChunk_Caves", m_ProfilingEnabled);
-
-    // Generate all cave noise grids once using SIMD batch (massive speedup!)
-    // Allocated on HEAP to prevent stack overflow
-    auto caveNoise = std::make_unique<CaveNoiseData>();
-    GenerateCaveNoiseData(*caveNoise, pos.x, pos.z, pos.y);
-
-    if (config.enableCaves || config.enableRavines) {
-      for (int x = 0; x < CHUNK_SIZE; ++x) {
-        for (int z = 0; z < CHUNK_SIZE; ++z) {
-          int gx = pos.x * CHUNK_SIZE + x;
-          int gz = pos.z * CHUNK_SIZE + z;
-          int height = column.heightMap[x][z];
-          bool isUnderwater = (height < config.seaLevel);
-
-          // Pre-calculate entrance zone for this column to avoid inner-loop
-          // lookups
+        // Only natural terrain (not water/ice above it) can be carved
+        int carveEnd = std::min(height, CHUNK_SIZE * 8) + 1 - baseY;
+        carveEnd = std::max(0, std::min(carveEnd, end));
+        if (caveNoise && carveEnd > 0) {
+          // Entrance zone is per column, not per voxel
           int idx2D = caveNoise->Index2D(x + 2, z + 2);
-          float entrance = caveNoise->entranceNoise[idx2D];
-          bool inEntranceZone = (entrance >= config.caveEntranceNoise);
-
-          for (int y = 0; y < CHUNK_SIZE; ++y) {
-            int gy = pos.y * CHUNK_SIZE + y;
-            if (gy > height || gy > CHUNK_SIZE * 8)
-              break;
-
-            // Only carve natural blocks, not air/water/lava.
-            BlockType currentType =
-                (BlockType)chunk.getBlock(x, y, z).getType();
-            if (currentType == AIR || currentType == WATER ||
-                currentType == LAVA)
-              continue;
-
-            bool preserveCrust = false;
-            if (gy <= 0) {
-              preserveCrust = true;
-            } else if (isUnderwater) {
-              if (gy > height - 3)
-                preserveCrust = true;
-            } else {
-              // Smart Crust: Protect top 2 blocks unless in an entrance zone
-              if (gy >= height - 2 && !inEntranceZone)
-                preserveCrust = true;
-            }
-
-            if (!preserveCrust) {
-              bool shouldCarve = false;
-              if (config.enableCaves &&
-                  caveGenerator->IsCaveAt(x, y, z, height, *caveNoise))
-                shouldCarve = true;
-              else if (config.enableRavines &&
-                       caveGenerator->IsRavineAt(x, y, z, gx, gy, gz, height,
-                                                 *caveNoise))
-                shouldCarve = true;
-
-              if (shouldCarve) {
-                if (gy <= config.lavaLevel)
-                  chunk.setBlock(x, y, z, LAVA);
-                else
-                  chunk.setBlock(x, y, z, AIR);
-              }
-            }
+          bool inEntranceZone =
+              caveNoise->entranceNoise[idx2D] >= config.caveEntranceNoise;
+
+          for (int y = 0; y < carveEnd; ++y) {
+            int gy = baseY + y;
+            if (IsCarved(*caveNoise, x, y, z, gx, gy, gz, height,
+                         inEntranceZone))
+              types[y] = (gy <= config.lavaLevel) ? LAVA : AIR;
           }
         }
-      }
-    }
-  }
 
-  // Pass 4: Final Touches (Bedrock & Post-fix)
-  {
-    PROFILE_SCOPE_CONDITIONAL("GenChunk_Finishing", m_ProfilingEnabled);
-    for (int x = 0; x < CHUNK_SIZE; ++x) {
-      for (int z = 0; z < CHUNK_SIZE; ++z) {
-        int gx = pos.x * CHUNK_SIZE + x;
-        int gz = pos.z * CHUNK_SIZE + z;
-        int height = column.heightMap[x][z];
-        float baseTemp = column.temperatureMap[x][z];
-        float humid = column.humidityMap[x][z];
-        float beachNoise = column.beachNoiseMap[x][z];
-
-        for (int y = 0; y < CHUNK_SIZE; ++y) {
-          int gy = pos.y * CHUNK_SIZE + y;
-          BlockType current = (BlockType)chunk.getBlock(x, y, z).getType();
-
-          // Bedrock Flattening
-          if (gy <= 4 && current != AIR && current != LAVA) {
-            if (gy > 0) {
-              int chance = 100 - (gy * 20);
-              if ((rand() % 100) < chance) {
-                // Re-call Surface Block gen for bedrock replacement?
-                // Original logic called GetSurfaceBlock again.
-                // We can use cached args.
-                BlockType type = GetSurfaceBlock(gx, gy, gz, height, baseTemp,
-                                                 humid, beachNoise, &column);
-                chunk.setBlock(x, y, z, type);
-              }
-            }
-          }
-
-          // Grass->Dirt under water fix
-          if (current == WATER && gy <= config.seaLevel) {
-            if (y > 0) {
-              if (chunk.getBlock(x, y - 1, z).getType() == GRASS) {
-                chunk.setBlock(x, y - 1, z, DIRT);
-              }
-            }
-          }
+        for (int y = 0; y < end; ++y) {
+          ChunkBlock &cell = chunk.blocks[x][y][z];
+          cell.block = m_BlockTable[types[y]];
+          cell.metadata = 0;
         }
       }
     }
@@ -1163,6 +1054,13 @@ void WorldGenerator::GenerateChunk(Chunk &chunk, const ChunkColumn &column) {
   // Apply Decorators
   {
     PROFILE_SCOPE_CONDITIONAL("Decorators", m_ProfilingEnabled);
+    // Structure placement is shared by every chunk of the column
+    std::call_once(column.structuresOnce, [&]() {
+      PROFILE_SCOPE_CONDITIONAL("Decorators_Plan", m_ProfilingEnabled);
+      for (auto d : decorators)
+        d->PlanStructures(*this, column, pos.x, pos.z, column.structures);
+    });
+
     for (auto d : decorators) {
       // Profile each decorator individually
       const char *decoratorName = "Decorator_Unknown";
@@ -1179,6 +1077,85 @@ void WorldGenerator::GenerateChunk(Chunk &chunk, const ChunkColumn &column) {
   }
 }
 
+int WorldGenerator::FillColumnSpans(BlockType *out, const ChunkColumn &column,
+                                    int x, int z, int gx, int gz, int baseY) {
+  int height = column.heightMap[x][z];
+  float baseTemp = column.temperatureMap[x][z];
+
+  // Local y ranges, bottom up: strata bands, surface layers, water, air
+  int end = std::max(height, config.seaLevel) + 1 - baseY;
+  end = std::max(0, std::min(end, CHUNK_SIZE));
+  if (end == 0)
+    return 0;
+
+  int strataTop = height - std::max(config.surfaceDepth, 1);
+  int strataEnd = std::max(0, std::min(strataTop + 1 - baseY, end));
+  int surfaceEnd = std::max(0, std::min(height + 1 - baseY, end));
+
+  // Strata: same bands as GetStrataBlock, shifted per column
+  if (strataEnd > 0) {
+    int offset = column.strataShift[x][z];
+    BlockType deep = (BlockType)column.strataDeep[x][z];
+    BlockType band = (BlockType)column.strataMid[x][z];
+
+    auto bandEnd = [&](int adjustedY, int from) {
+      return std::max(from, std::min(adjustedY - offset - baseY, strataEnd));
+    };
+    int deepEnd = bandEnd(12, 0);
+    int stoneEnd = bandEnd(20, deepEnd);
+    int bandTop = bandEnd(25, stoneEnd);
+    std::fill(out, out + deepEnd, deep);
+    std::fill(out + deepEnd, out + stoneEnd, STONE);
+    std::fill(out + stoneEnd, out + bandTop, band);
+    std::fill(out + bandTop, out + strataEnd, STONE);
+  }
+
+  // Surface layers depend on the altitude-adjusted climate, so they are the
+  // only voxels evaluated one by one
+  for (int y = strataEnd; y < surfaceEnd; ++y) {
+    out[y] = GetSurfaceBlock(gx, baseY + y, gz, height, baseTemp,
+                             column.humidityMap[x][z],
+                             column.beachNoiseMap[x][z], &column);
+  }
+
+  // Water up to sea level; ice only forms on the surface of cold seas
+  if (surfaceEnd < end) {
+    std::fill(out + surfaceEnd, out + end, WATER);
+    if (baseTemp < -0.3f && config.seaLevel - baseY == end - 1)
+      out[end - 1] = ICE;
+    // No grass under water
+    if (surfaceEnd > 0 && out[surfaceEnd - 1] == GRASS &&
+        out[surfaceEnd] == WATER)
+      out[surfaceEnd - 1] = DIRT;
+  }
+
+  return end;
+}
+
+bool WorldGenerator::IsCarved(const CaveNoiseData &caveNoise, int x, int y,
+                              int z, int gx, int gy, int gz, int height,
+                              bool inEntranceZone) {
+  bool preserveCrust = false;
+  if (gy <= 0) {
+    preserveCrust = true;
+  } else if (height < config.seaLevel) {
+    if (gy > height - 3)
+      preserveCrust = true;
+  } else {
+    // Smart Crust: Protect top 2 blocks unless in an entrance zone
+    if (gy >= height - 2 && !inEntranceZone)
+      preserveCrust = true;
+  }
+  if (preserveCrust)
+    return false;
+
+  if (config.enableCaves &&
+      caveGenerator->IsCaveAt(x, y, z, height, caveNoise))
+    return true;
+  return config.enableRavines &&
+         caveGenerator->IsRavineAt(x, y, z, gx, gy, gz, height, caveNoise);
+}
+
 // FastNoise2 Wrapper Implementation
 void WorldGenerator::InitializeFastNoise() {
   std::lock_guard<std::mutex> lock(m_InitMutex);
@@ -1285,6 +1262,18 @@ void WorldGenerator::GenerateHeightGrid(float *output, int startX, int startZ,
                                     config.terrainScale, m_Seed);
 }
 
+void WorldGenerator::GenerateRiverGrid(float *output, int startX, int startZ,
+                                       int width, int height) const {
+  if (!m_PerlinNoise2D)
+    const_cast<WorldGenerator *>(this)->InitializeFastNoise();
+
+  // Same samples as GetRiverCarveFactor
+  int seedR = (m_Seed * 1234) % 65536;
+  m_PerlinNoise2D->GenUniformGrid2D(output, (float)startX + seedR,
+                                    (float)startZ + seedR, width, height,
+                                    config.riverScale, m_Seed + 600);
+}
+
 void WorldGenerator::GenerateLandformGrid(float *output, int startX, int startZ,
                                           int width, int height) const {
   if (!m_LandformNoise)
@@ -1311,12 +1300,53 @@ void WorldGenerator::FastNoiseGrid3D(float *output, int startX, int startY,
                                     m_Seed + seedOffset);
 }
 
+// Expands one CaveNoiseData lattice to the full padded grid
+static void ExpandCaveLattice(const float *lattice, float *out) {
+  const int SIZE = CaveNoiseData::SIZE;
+  const int STEP = CaveNoiseData::LATTICE_STEP;
+  const int L = CaveNoiseData::LATTICE;
+
+  // Lattice cell and blend weight of every padded index, same on each axis
+  int cell[SIZE];
+  float frac[SIZE];
+  for (int p = 0; p < SIZE; ++p) {
+    int u = p - 2 + STEP; // Blocks from the lattice origin
+    cell[p] = u / STEP;
+    frac[p] = (float)(u % STEP) / (float)STEP;
+  }
+
+  float row[L];
+  for (int z = 0; z < SIZE; ++z) {
+    for (int y = 0; y < SIZE; ++y) {
+      // Collapse the four lattice rows around (y, z) to one, then blend in x
+      const float *r00 = lattice + cell[y] * L + cell[z] * L * L;
+      const float *r10 = r00 + L;
+      const float *r01 = r00 + L * L;
+      const float *r11 = r01 + L;
+      float ty = frac[y];
+      float tz = frac[z];
+      for (int k = 0; k < L; ++k) {
+        float a = r00[k] + (r10[k] - r00[k]) * ty;
+        float b = r01[k] + (r11[k] - r01[k]) * ty;
+        row[k] = a + (b - a) * tz;
+      }
+
+      float *dst = out + (y + z * SIZE) * SIZE;
+      for (int x = 0; x < SIZE; ++x) {
+        float a = row[cell[x]];
+        dst[x] = a + (row[cell[x] + 1] - a) * frac[x];
+      }
+    }
+  }
+}
+
 // Generate all cave noise grids for a chunk in one batch (SIMD optimized)
 void WorldGenerator::GenerateCaveNoiseData(CaveNoiseData &data, int chunkX,
                                            int chunkZ, int chunkY) {
   const int SIZE = CaveNoiseData::SIZE; // 36x36x36
-  const int chunkWorldX = chunkX * 32;  // CHUNK_SIZE = 32
-  const int chunkWorldY = chunkY * 32;
+  const int STEP = CaveNoiseData::LATTICE_STEP;
+  const int L = CaveNoiseData::LATTICE;
+  const int chunkWorldX = chunkX * 32; // CHUNK_SIZE = 32
   const int chunkWorldZ = chunkZ * 32;
 
   // Calculate seeds
@@ -1332,27 +1362,34 @@ void WorldGenerator::GenerateCaveNoiseData(CaveNoiseData &data, int chunkX,
   float spagModScale = 0.01f * (config.caveFrequency / 0.015f);
   float spagNoiseScale = 0.03f * (config.caveFrequency / 0.015f);
 
-  // Generate all 4 3D noise grids using SIMD batch
-  // Start at -2 for padding, size 36 = 32 + 4
-  int startX = chunkWorldX - 2 + seedX;
-  int startY = chunkWorldY - 2 + seedY;
-  int startZ = chunkWorldZ - 2 + seedZ;
+  // The 3D fields are low frequency, so they are sampled on a coarse lattice
+  // (L^3 instead of SIZE^3 points per field) in lattice units, which keeps
+  // the lattice aligned across chunks. It starts one step below the chunk
+  // corner so the padded grid is fully covered.
+  int startX = chunkX * (32 / STEP) - 1 + seedX / STEP;
+  int startY = chunkY * (32 / STEP) - 1 + seedY / STEP;
+  int startZ = chunkZ * (32 / STEP) - 1 + seedZ / STEP;
 
   // 1. Cheese cave noise (seed offset 1000)
-  FastNoiseGrid3D(data.cheeseNoise, startX, startY, startZ, SIZE, SIZE, SIZE,
-                  cheeseScale, 1000);
+  FastNoiseGrid3D(data.lattice[0], startX, startY, startZ, L, L, L,
+                  cheeseScale * STEP, 1000);
 
   // 2. Spaghetti size modifier (seed offset 2000)
-  FastNoiseGrid3D(data.spaghettiMod, startX, startY, startZ, SIZE, SIZE, SIZE,
-                  spagModScale, 2000);
+  FastNoiseGrid3D(data.lattice[1], startX, startY, startZ, L, L, L,
+                  spagModScale * STEP, 2000);
 
   // 3. Spaghetti noise 1 (seed offset 3000)
-  FastNoiseGrid3D(data.spaghettiNoise1, startX, startY, startZ, SIZE, SIZE,
-                  SIZE, spagNoiseScale, 3000);
+  FastNoiseGrid3D(data.lattice[2], startX, startY, startZ, L, L, L,
+                  spagNoiseScale * STEP, 3000);
+
+  // 4. Spaghetti noise 2, shifted ~100 blocks (seed offset 3000)
+  FastNoiseGrid3D(data.lattice[3], startX + 25, startY + 24, startZ + 25, L, L,
+                  L, spagNoiseScale * STEP, 3000);
 
-  // 4. Spaghetti noise 2 with offset (seed offset 3000)
-  FastNoiseGrid3D(data.spaghettiNoise2, startX + 100, startY + 98, startZ + 100,
-                  SIZE, SIZE, SIZE, spagNoiseScale, 3000);
+  ExpandCaveLattice(data.lattice[0], data.cheeseNoise);
+  ExpandCaveLattice(data.lattice[1], data.spaghettiMod);
+  ExpandCaveLattice(data.lattice[2], data.spaghettiNoise1);
+  ExpandCaveLattice(data.lattice[3], data.spaghettiNoise2);
 
   // 5. Entrance noise (2D, seed offset 5000)
   FastNoiseGrid2D(data.entranceNoise, chunkWorldX - 2 + seedX,
@@ -12,6 +12,7 @@
 #include <vector>
 
 class Chunk;
+class ColumnCache;
 class WorldDecorator;
 
 enum Biome {
@@ -25,6 +26,17 @@ enum Biome {
 
 struct ChunkColumn;
 
+// Whole-world climate/terrain maps for WorldGenConfig::fixedWorld. Built once
+// and shared read-only by every generator (index = x + z * size, centred on
+// the world origin).
+struct FixedWorldMaps {
+  int size = 0;
+  std::vector<int> heightMap;
+  std::vector<float> tempMap;
+  std::vector<float> humidMap;
+  std::vector<Biome> biomeMap;
+};
+
 // Pre-computed noise data for batch cave generation
 struct CaveNoiseData {
   static constexpr int SIZE = 32 + 4; // CHUNK_SIZE + padding for nearby samples
@@ -34,6 +46,13 @@ struct CaveNoiseData {
   float spaghettiNoise2[SIZE * SIZE * SIZE];
   float entranceNoise[SIZE * SIZE]; // 2D for surface
 
+  // The 3D fields above are trilinearly interpolated from these coarse
+  // lattices (cheese, spaghetti mod, spaghetti 1, spaghetti 2), sampled every
+  // LATTICE_STEP blocks starting LATTICE_STEP blocks below the chunk corner
+  static constexpr int LATTICE_STEP = 4;
+  static constexpr int LATTICE = (SIZE + 2) / LATTICE_STEP + 2; // Per axis
+  float lattice[4][LATTICE * LATTICE * LATTICE];
+
   // Helper to get 3D index
   inline int Index3D(int x, int y, int z) const {
     return x + y * SIZE + z * SIZE * SIZE;
@@ -89,9 +108,36 @@ public:
   WorldGenerator(const WorldGenConfig &config);
   ~WorldGenerator();
   void GenerateFixedMaps(); // Pre-calculate maps if fixed world is enabled
+  // Builds the fixed-world maps in tiles across 'threadCount' threads (0 =
+  // hardware concurrency). Returns null if fixedWorld is off.
+  static std::shared_ptr<const FixedWorldMaps>
+  BuildFixedMaps(const WorldGenConfig &config, int threadCount = 0);
+  void SetFixedMaps(std::shared_ptr<const FixedWorldMaps> maps) {
+    m_FixedMaps = std::move(maps);
+  }
+  // Optional persistent cache: GenerateColumns copies cached columns and
+  // only runs the noise stage for the rest, which it then stores
+  void SetColumnCache(std::shared_ptr<ColumnCache> cache) {
+    m_ColumnCache = std::move(cache);
+  }
   void GenerateColumn(ChunkColumn &column, int cx, int cz);
+  // Batched form: fills the regionSize x regionSize block of columns whose
+  // first column is (cx, cz) from one set of noise grids.
+  // columns[dx + dz * regionSize] may be null to skip that column.
+  static const int COLUMN_REGION = 4;
+  // Bump whenever GenerateColumns' output changes for an unchanged config
+  // (height kernel, strata, biome classification, noise seeds, ...) so
+  // column caches written by older code are discarded
+  static const uint32_t GENERATOR_VERSION = 1;
+  void GenerateColumns(ChunkColumn *const *columns, int cx, int cz,
+                       int regionSize);
   void GenerateChunk(Chunk &chunk, const ChunkColumn &column);
-  int GetHeight(int x, int z); // Converted to Instance Method
+  int GetHeight(int x, int z); // Single-point GenerateHeightMap
+  // Terrain height (landform blend + river carving) of a width x depth grid
+  // starting at (startX, startZ), out[x + z * width]. Every noise field is
+  // generated as one SIMD grid; only the blend runs per point.
+  void GenerateHeightMap(int *out, int startX, int startZ, int width,
+                         int depth) const;
   float GetTemperature(int x, int z, int y = -1);
   float GetHumidity(int x, int z);
   Biome GetBiome(int x, int z, int y = -1);
@@ -106,16 +152,23 @@ public:
                             bool checkCarving = false);
   float GetBeachNoise(int gx, int gz);
   bool IsCaveAt(int x, int y, int z);
+  // For callers that already know the surface height at (x, z)
+  bool IsCaveAt(int x, int y, int z, int surfaceHeight);
   float GetCaveProbability(int x, int z);
   int GetSeed() const { return m_Seed; }
   const WorldGenConfig &GetConfig() const { return config; }
   // Returns 0.0 to 1.0 intensity of the river channel
   float GetRiverCarveFactor(int x, int z);
+  float RiverCarveFromNoise(float riverNoise) const;
   float GetLandformNoise(int x, int z);
   int CalculateHeightFromNoise(float hNoise, float lNoise) const;
 
   // Get height for a specific landform without blending
   int GetHeightForLandform(const std::string &name, int x, int z);
+  // Batched form, one SIMD grid per octave
+  void GenerateLandformHeightMap(const std::string &name, int *out,
+                                 int startX, int startZ, int width,
+                                 int depth) const;
 
   void GetLandformBlend(int x, int z, std::string &primary,
                         std::string &secondary, float &blendFactor);
@@ -147,19 +200,39 @@ public:
                           int height) const;
   void GenerateLandformGrid(float *output, int startX, int startZ, int width,
                             int height) const;
+  void GenerateRiverGrid(float *output, int startX, int startZ, int width,
+                         int height) const;
 
   // Generate all cave noise grids for a chunk at once (SIMD batch)
   void GenerateCaveNoiseData(CaveNoiseData &data, int chunkX, int chunkZ,
                              int chunkY);
 
 private:
-  BlockType GetStrataBlock(int x, int y, int z);
+  // Strata block at a world position below the surface layers. Reads the
+  // column's precomputed layout when given, else samples the strata noise.
+  BlockType GetStrataBlock(int gx, int gy, int gz, const ChunkColumn *column);
+  static void ClassifyStrata(float layerWave, float typeNoise, int &shift,
+                             BlockType &deep, BlockType &mid);
+  // Lowers a height into its river channel, carveFactor from
+  // RiverCarveFromNoise
+  int ApplyRiverCarve(int height, float carveFactor) const;
   // Compute methods (On-the-fly calculation)
-  int ComputeHeight(int x, int z);
   float ComputeTemperature(int x, int z, int y = -1);
   float ComputeHumidity(int x, int z);
   Biome ComputeBiome(int x, int z, int y = -1, float preTemp = -1.0f,
                      float preHumid = -1.0f);
+  static Biome ClassifyBiome(float temperature, float humidity);
+  // Fills the CHUNK_SIZE voxels of local column (x, z) starting at world
+  // height baseY and returns how many of them, from the bottom, are not air
+  int FillColumnSpans(BlockType *out, const ChunkColumn &column, int x, int z,
+                      int gx, int gz, int baseY);
+  // Cave/ravine test for a natural voxel of the chunk being generated,
+  // honouring the protected surface crust
+  bool IsCarved(const CaveNoiseData &caveNoise, int x, int y, int z, int gx,
+                int gy, int gz, int height, bool inEntranceZone);
+  // Fills one square tile of 'maps' starting at index (tileX, tileZ)
+  void FillFixedMapTile(FixedWorldMaps &maps, int tileX, int tileZ,
+                        int tileSize);
 
   // Noise map methods
   float GetClimateNoise(int x, int z);
@@ -181,6 +254,10 @@ private:
   bool m_Initialized = false;
   bool m_ProfilingEnabled = false;
   std::mutex m_InitMutex;
+  // Cave noise scratch, reused by every chunk this generator builds
+  std::unique_ptr<CaveNoiseData> m_CaveNoise;
+  // Registry blocks by id, resolved once so generation skips the lookup
+  Block *m_BlockTable[256];
 
   // FastNoise2 nodes
   FastNoise::SmartNode<> m_PerlinNoise2D;
@@ -191,11 +268,9 @@ private:
   FastNoise::SmartNode<> m_BeachNoise;
   FastNoise::SmartNode<> m_LandformNoise;
 
-  // Fixed world maps (Linearized 2D arrays: index = x + z * size)
-  std::vector<int> fixedHeightMap;
-  std::vector<float> fixedTempMap;
-  std::vector<float> fixedHumidMap;
-  std::vector<Biome> fixedBiomeMap;
+  // Fixed world maps, shared between generators
+  std::shared_ptr<const FixedWorldMaps> m_FixedMaps;
+  std::shared_ptr<ColumnCache> m_ColumnCache;
 };
 
 #endif